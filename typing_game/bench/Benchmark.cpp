@@ -0,0 +1,220 @@
+// Headless benchmark: runs scripted typing sessions through Game with no frame cap and
+// reports update/render time percentiles and C++ heap allocations per frame for each mode.
+//
+// Usage: typing_game_bench [frames per scenario] [keystroke every N frames] [word seed]
+// Run from the typing_game directory so assets/ and wordlists/ resolve.
+
+#include "Game.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+// Count every C++ heap allocation (SDL's own mallocs aren't included)
+static std::atomic<size_t> allocationCount{ 0 };
+
+void* operator new(std::size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1)) {
+		return p;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+struct Scenario {
+	const char* name;
+	GameState mode;
+	int arcadeLevel;
+};
+
+struct FrameSamples {
+	std::vector<double> updateUs;
+	std::vector<double> renderUs;
+	std::vector<size_t> allocations;
+	int otherFrames = 0; // Frames spent on results/title screens between rounds
+};
+
+static double percentile(std::vector<double> values, double p)
+{
+	if (values.empty()) {
+		return 0.0;
+	}
+	std::sort(values.begin(), values.end());
+	return values[static_cast<size_t>(p * (values.size() - 1))];
+}
+
+static void pushTextInput(char c)
+{
+	SDL_Event e = {};
+	e.type = SDL_TEXTINPUT;
+	e.text.timestamp = SDL_GetTicks();
+	e.text.text[0] = c;
+	SDL_PushEvent(&e);
+}
+
+static void pushKey(SDL_Keycode key)
+{
+	SDL_Event e = {};
+	e.type = SDL_KEYDOWN;
+	e.key.timestamp = SDL_GetTicks();
+	e.key.keysym.sym = key;
+	SDL_PushEvent(&e);
+}
+
+static FrameSamples runScenario(Game& game, const Scenario& scenario, int frames, int framesPerKey)
+{
+	FrameSamples samples;
+	samples.updateUs.reserve(frames);
+	samples.renderUs.reserve(frames);
+	samples.allocations.reserve(frames);
+
+	const double usPerTick = 1000000.0 / SDL_GetPerformanceFrequency();
+	const int typoEvery = 25; // Every 25th key is a typo, fixed with backspace on the next key
+	int keysTyped = 0;
+	bool fixTypo = false;
+
+	game.startMode(scenario.mode, scenario.arcadeLevel);
+
+	for (int frame = 0; frame < frames; frame++) {
+		GameState state = game.getState();
+
+		// Between rounds: continue like a player would, or restart the mode if the session ended
+		if (state == GameState::ARCADE_RESULTS || state == GameState::BONUS_TITLE || state == GameState::BONUS_RESULTS) {
+			pushKey(SDLK_RETURN);
+		}
+		else if (state != scenario.mode && !(scenario.mode == GameState::ARCADE_MODE && state == GameState::BONUS_STAGE)) {
+			game.startMode(scenario.mode, scenario.arcadeLevel);
+			state = game.getState();
+		}
+
+		// Scripted typing
+		if (frame % framesPerKey == 0) {
+			std::string_view pending = game.getPendingInput();
+
+			if (fixTypo) {
+				if (state != GameState::LESSONS_MODE) {
+					pushKey(SDLK_BACKSPACE);
+				}
+				fixTypo = false;
+			}
+			else if (!pending.empty()) {
+				if (++keysTyped % typoEvery == 0 && pending[0] != ' ') {
+					pushTextInput(pending[0] == 'x' ? 'z' : 'x');
+					fixTypo = true;
+				}
+				else {
+					pushTextInput(pending[0]);
+				}
+			}
+		}
+
+		Uint64 start = SDL_GetPerformanceCounter();
+		size_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+
+		game.handleEvents();
+		game.update();
+		Uint64 updated = SDL_GetPerformanceCounter();
+
+		game.render();
+		Uint64 rendered = SDL_GetPerformanceCounter();
+
+		size_t allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
+		if (state == scenario.mode) {
+			samples.updateUs.push_back((updated - start) * usPerTick);
+			samples.renderUs.push_back((rendered - updated) * usPerTick);
+			samples.allocations.push_back(allocations);
+		}
+		else {
+			samples.otherFrames++;
+		}
+
+		if (!game.running()) {
+			break;
+		}
+	}
+
+	return samples;
+}
+
+static void report(const Scenario& scenario, const FrameSamples& samples)
+{
+	size_t totalAllocations = 0;
+	size_t peakAllocations = 0;
+	for (size_t count : samples.allocations) {
+		totalAllocations += count;
+		peakAllocations = std::max(peakAllocations, count);
+	}
+	double averageAllocations = samples.allocations.empty() ? 0.0 : static_cast<double>(totalAllocations) / samples.allocations.size();
+
+	std::printf("%-12s %6zu %6d | %8.1f %8.1f %8.1f %8.1f | %8.1f %8.1f %8.1f %8.1f | %7.1f %6zu\n",
+		scenario.name, samples.updateUs.size(), samples.otherFrames,
+		percentile(samples.updateUs, 0.50), percentile(samples.updateUs, 0.95),
+		percentile(samples.updateUs, 0.99), percentile(samples.updateUs, 1.0),
+		percentile(samples.renderUs, 0.50), percentile(samples.renderUs, 0.95),
+		percentile(samples.renderUs, 0.99), percentile(samples.renderUs, 1.0),
+		averageAllocations, peakAllocations);
+}
+
+int main(int argc, char* argv[])
+{
+	int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 600;
+	int framesPerKey = argc > 2 ? std::max(1, std::atoi(argv[2])) : 3;
+	unsigned long wordSeed = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1; // Fixed by default so runs type the same words
+
+	// No window, no GPU, no audio device needed
+	SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+	SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+	SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+	Game* game = new Game();
+	game->init("Letter RIP (benchmark)", 1600, 900, false);
+
+	if (!game->running()) {
+		std::printf("Failed to start the game: %s\n", SDL_GetError());
+		return 1;
+	}
+
+	// Even picks from the seed alone, whatever the save says this player misses
+	game->ignoreWordWeakness();
+	game->seedWords(static_cast<uint32_t>(wordSeed));
+
+	const Scenario scenarios[] = {
+		{ "lessons", GameState::LESSONS_MODE, 1 },
+		{ "arcade-1", GameState::ARCADE_MODE, 1 },
+		{ "arcade-11", GameState::ARCADE_MODE, 11 },
+		{ "arcade-25", GameState::ARCADE_MODE, 25 },
+		{ "bonus", GameState::BONUS_STAGE, 1 },
+		{ "wpm", GameState::WPM_TEST, 1 },
+	};
+
+	std::vector<FrameSamples> results;
+	for (const Scenario& scenario : scenarios) {
+		results.push_back(runScenario(*game, scenario, frames, framesPerKey));
+	}
+
+	std::printf("\n%d frames per scenario, a keystroke every %d frame(s), word seed %lu, times in microseconds\n\n", frames, framesPerKey, wordSeed);
+	std::printf("%-12s %6s %6s | %8s %8s %8s %8s | %8s %8s %8s %8s | %7s %6s\n",
+		"scenario", "frames", "other", "upd p50", "upd p95", "upd p99", "upd max",
+		"rnd p50", "rnd p95", "rnd p99", "rnd max", "alloc/f", "peak");
+	for (size_t i = 0; i < results.size(); i++) {
+		report(scenarios[i], results[i]);
+	}
+
+	game->clean();
+	return 0;
+}
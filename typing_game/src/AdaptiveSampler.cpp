@@ -0,0 +1,150 @@
+#include "AdaptiveSampler.h"
+#include <cctype>
+
+static int foldCharacter(char c)
+{
+	unsigned char u = static_cast<unsigned char>(c);
+	if (u >= AdaptiveSampler::CHARACTERS) {
+		return -1;
+	}
+	return std::tolower(u);
+}
+
+// Index which words contain which characters (two passes: count per character, then fill), then build each
+// character's table over its words
+void AdaptiveSampler::build(const WordList& words)
+{
+	uint32_t counts[CHARACTERS] = {};
+	uint32_t seen[CHARACTERS] = {};
+
+	for (size_t i = 0; i < words.size(); i++) {
+		for (char c : words[i]) {
+			int folded = foldCharacter(c);
+			if (folded >= 0 && seen[folded] != i + 1) {
+				seen[folded] = static_cast<uint32_t>(i + 1);
+				counts[folded]++;
+			}
+		}
+	}
+
+	postingStart[0] = 0;
+	for (int c = 0; c < CHARACTERS; c++) {
+		postingStart[c + 1] = postingStart[c] + counts[c];
+	}
+
+	postings.assign(postingStart[CHARACTERS], Posting{ 0, 0 });
+	uint32_t next[CHARACTERS];
+	for (int c = 0; c < CHARACTERS; c++) {
+		next[c] = postingStart[c];
+		seen[c] = 0;
+		letterCount[c] = 0;
+	}
+
+	for (size_t i = 0; i < words.size(); i++) {
+		for (char c : words[i]) {
+			int folded = foldCharacter(c);
+			if (folded < 0) continue;
+
+			// Each word gets one posting per character, repeats bump its count
+			letterCount[folded]++;
+			if (seen[folded] != i + 1) {
+				seen[folded] = static_cast<uint32_t>(i + 1);
+				postings[next[folded]++] = Posting{ static_cast<uint32_t>(i), 1 };
+			}
+			else {
+				postings[next[folded] - 1].count++;
+			}
+		}
+	}
+
+	postingProbability.resize(postings.size());
+	postingAlias.resize(postings.size());
+	scratchWeights.resize(postings.size());
+	for (size_t p = 0; p < postings.size(); p++) {
+		scratchWeights[p] = postings[p].count;
+	}
+	for (int c = 0; c < CHARACTERS; c++) {
+		uint32_t start = postingStart[c];
+		buildTable(scratchWeights.data() + start, postingStart[c + 1] - start,
+			postingProbability.data() + start, postingAlias.data() + start);
+	}
+
+	wordCount = words.size();
+
+	float none[CHARACTERS] = {};
+	setWeakness(none);
+}
+
+void AdaptiveSampler::setWeakness(const float* weakness)
+{
+	double partWeights[PARTS];
+	partWeights[0] = static_cast<double>(wordCount);
+	for (int c = 0; c < CHARACTERS; c++) {
+		partWeights[c + 1] = BOOST * weakness[c] * letterCount[c];
+	}
+
+	buildTable(partWeights, PARTS, partProbability, partAlias);
+}
+
+size_t AdaptiveSampler::draw(std::mt19937& rng) const
+{
+	std::uniform_real_distribution<double> coin(0.0, 1.0);
+
+	std::uniform_int_distribution<uint32_t> pickPart(0, PARTS - 1);
+	uint32_t part = pickPart(rng);
+	if (coin(rng) >= partProbability[part]) {
+		part = partAlias[part];
+	}
+
+	// A character no word has only comes up through rounding in the table, the even part stands in for it
+	if (part == 0 || letterCount[part - 1] == 0) {
+		std::uniform_int_distribution<size_t> pickWord(0, wordCount - 1);
+		return pickWord(rng);
+	}
+
+	// A word containing the character, weighted by how many times it appears in it
+	int c = static_cast<int>(part - 1);
+	uint32_t start = postingStart[c];
+	std::uniform_int_distribution<uint32_t> pickPosting(0, postingStart[c + 1] - start - 1);
+	uint32_t column = pickPosting(rng);
+	if (coin(rng) >= postingProbability[start + column]) {
+		column = postingAlias[start + column];
+	}
+	return postings[start + column].word;
+}
+
+// Vose's alias method over weights[0..n), aliases are 0..n-1. Columns with no weight never keep their own
+// column, so as long as the total isn't 0 they're never drawn
+void AdaptiveSampler::buildTable(const double* weights, size_t n, double* probability, uint32_t* alias)
+{
+	small.clear();
+	large.clear();
+
+	double total = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		total += weights[i];
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		probability[i] = total > 0.0 ? weights[i] * n / total : 1.0;
+		alias[i] = static_cast<uint32_t>(i);
+		(probability[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+	}
+
+	while (!small.empty() && !large.empty()) {
+		uint32_t less = small.back();
+		small.pop_back();
+		uint32_t more = large.back();
+
+		alias[less] = more;
+		probability[more] -= 1.0 - probability[less];
+		if (probability[more] < 1.0) {
+			large.pop_back();
+			small.push_back(more);
+		}
+	}
+
+	// Whatever's left is 1 up to rounding
+	for (uint32_t i : small) probability[i] = 1.0;
+	for (uint32_t i : large) probability[i] = 1.0;
+}
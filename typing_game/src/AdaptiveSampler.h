@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+#include <random>
+#include <cstdint>
+#include "WordListManager.h"
+
+// Draws words from one list with extra weight on words containing the player's weak characters.
+// A word weighs 1 + BOOST * (weakness of each of its letters, summed), which splits into an even part (the 1s) plus
+// one part per character. A draw picks a part by its share of the total, then a word from it: any word for the even
+// part, or a word containing the character, as likely as the number of times it appears.
+// Both picks use alias tables, so a draw is O(1). Each character's table only depends on the list and is built once,
+// a weakness change only rebuilds the small table over the parts, O(CHARACTERS), and never touches the words.
+class AdaptiveSampler
+{
+public:
+	static constexpr int CHARACTERS = 128;
+	static constexpr double BOOST = 4.0; // Extra weight per weak letter, a word with no weak letters weighs 1
+
+	void build(const WordList& words);
+	bool isBuilt() const { return wordCount > 0; }
+
+	// weakness[c] in 0..1 (0 = never missed, 1 = the player's worst character), letters are case-folded
+	void setWeakness(const float* weakness);
+
+	// Index of a word in the list, weighted by weakness
+	size_t draw(std::mt19937& rng) const;
+
+private:
+	static constexpr int PARTS = CHARACTERS + 1; // The even part, then one per character
+
+	struct Posting {
+		uint32_t word;
+		uint32_t count; // How many times the character appears in it
+	};
+
+	std::vector<Posting> postings;       // Grouped by character
+	uint32_t postingStart[CHARACTERS + 1] = {};
+	uint32_t letterCount[CHARACTERS] = {}; // Times each character appears in the whole list
+	size_t wordCount = 0;
+
+	// Alias tables: pick a column, keep it with probability[column], otherwise take alias[column].
+	// The postings' tables are laid out like postings, one per character group, with aliases relative to the group.
+	std::vector<double> postingProbability;
+	std::vector<uint32_t> postingAlias;
+	double partProbability[PARTS] = {};
+	uint32_t partAlias[PARTS] = {};
+
+	std::vector<double> scratchWeights;
+	std::vector<uint32_t> small, large; // Scratch for building tables
+
+	void buildTable(const double* weights, size_t n, double* probability, uint32_t* alias);
+};
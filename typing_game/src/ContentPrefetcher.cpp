@@ -0,0 +1,390 @@
+#include "ContentPrefetcher.h"
+#include <cmath>
+#include <utility>
+#include <algorithm>
+
+ContentPrefetcher::~ContentPrefetcher()
+{
+	stop();
+}
+
+void ContentPrefetcher::start(const WordListManager* words, float playerX, float playerY, int fieldWidth)
+{
+	stop();
+
+	this->words = words;
+	this->playerX = playerX;
+	this->playerY = playerY;
+	this->fieldWidth = fieldWidth;
+	spawnGrid = SpatialHash(-256, -256, fieldWidth + 256, 1156); // Same margins as zombieGrid, spawns land past the edges
+
+	// Lines circulate between the ring, the scratch buffer and the caller, size them all for a full line once
+	for (std::string& line : lines) {
+		line.reserve(LINE_WORDS * 16);
+	}
+	lineScratch.reserve(LINE_WORDS * 16);
+
+	stopping = false;
+	worker = std::thread(&ContentPrefetcher::run, this);
+}
+
+void ContentPrefetcher::stop()
+{
+	if (!worker.joinable()) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	wake.notify_one();
+	worker.join();
+}
+
+void ContentPrefetcher::seed(uint32_t value)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	baseSeed = value;
+	generation++;
+
+	lineHead = 0;
+	lineCount = 0;
+	nextLineSerial = 0;
+	linesTaken = 0;
+	lineWeakness.assign(1, LineWeakness{ 0, weakness });
+
+	// Keep what's been asked for, but rebuild it from the new seed and the current weakness
+	waveRequests = 0;
+	if (waveRequest.wanted >= 0) {
+		waveRequest.serial = ++waveRequests;
+		waveRequest.ready = false;
+		waveRequest.weakness = weakness;
+	}
+
+	bonusRequests = 0;
+	if (bonusRequest.wanted >= 0) {
+		bonusRequest.serial = ++bonusRequests;
+		bonusRequest.ready = false;
+	}
+
+	wake.notify_one();
+}
+
+void ContentPrefetcher::setWeakness(const float* values)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::copy(values, values + AdaptiveSampler::CHARACTERS, weakness.values);
+
+	// Lines up to LINE_QUEUE ahead may already be built, so it starts right after them whatever the worker has done
+	uint32_t firstLine = linesTaken + LINE_QUEUE;
+	if (lineWeakness.back().firstLine == firstLine) {
+		lineWeakness.back().weakness = weakness;
+	}
+	else {
+		lineWeakness.push_back(LineWeakness{ firstLine, weakness });
+	}
+}
+
+void ContentPrefetcher::takeLine(std::string& line)
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (!worker.joinable()) {
+		std::mt19937 rng = generatorFor(LINE, nextLineSerial);
+		buildLine(rng, weaknessForLine(nextLineSerial), line);
+		nextLineSerial++;
+	}
+	else {
+		done.wait(lock, [this] { return lineCount > 0; });
+
+		std::swap(line, lines[lineHead]);
+		lineHead = (lineHead + 1) % LINE_QUEUE;
+		lineCount--;
+	}
+
+	// Weakness no line still to come uses can go
+	linesTaken++;
+	while (lineWeakness.size() > 1 && lineWeakness[1].firstLine <= linesTaken) {
+		lineWeakness.erase(lineWeakness.begin());
+	}
+
+	wake.notify_one();
+}
+
+void ContentPrefetcher::requestWave(int level)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (waveRequest.wanted == level) {
+		return;
+	}
+
+	waveRequest.wanted = level;
+	waveRequest.serial = ++waveRequests;
+	waveRequest.ready = false;
+	waveRequest.weakness = weakness;
+	wake.notify_one();
+}
+
+void ContentPrefetcher::takeWave(int level, WavePlan& plan)
+{
+	requestWave(level);
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (!worker.joinable()) {
+		std::mt19937 rng = generatorFor(WAVE, waveRequest.serial);
+		buildWave(level, rng, waveRequest.weakness, plan);
+	}
+	else {
+		done.wait(lock, [this] { return waveRequest.ready; });
+		std::swap(plan, wave);
+	}
+
+	waveRequest = Request();
+}
+
+void ContentPrefetcher::requestBonus(int bonusLevel)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (bonusRequest.wanted == bonusLevel) {
+		return;
+	}
+
+	bonusRequest.wanted = bonusLevel;
+	bonusRequest.serial = ++bonusRequests;
+	bonusRequest.ready = false;
+	wake.notify_one();
+}
+
+void ContentPrefetcher::takeBonus(int bonusLevel, BonusPlan& plan)
+{
+	requestBonus(bonusLevel);
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (!worker.joinable()) {
+		std::mt19937 rng = generatorFor(BONUS, bonusRequest.serial);
+		buildBonus(bonusLevel, rng, plan);
+	}
+	else {
+		done.wait(lock, [this] { return bonusRequest.ready; });
+		std::swap(plan, bonus);
+	}
+
+	bonusRequest = Request();
+}
+
+// Worker: keep the line queue full and build whatever plan is asked for, building outside the lock
+void ContentPrefetcher::run()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true) {
+		wake.wait(lock, [this] {
+			return stopping || lineCount < LINE_QUEUE ||
+				(waveRequest.wanted >= 0 && !waveRequest.ready) ||
+				(bonusRequest.wanted >= 0 && !bonusRequest.ready);
+		});
+
+		if (stopping) {
+			return;
+		}
+
+		uint32_t builtFor = generation;
+
+		// Plans first, a take may already be waiting on one, while the line queue always has some slack
+		if (waveRequest.wanted >= 0 && !waveRequest.ready) {
+			Request request = waveRequest;
+			std::mt19937 rng = generatorFor(WAVE, request.serial);
+
+			lock.unlock();
+			buildWave(request.wanted, rng, request.weakness, waveScratch);
+			lock.lock();
+
+			if (builtFor == generation && waveRequest.wanted == request.wanted && waveRequest.serial == request.serial) {
+				std::swap(wave, waveScratch);
+				waveRequest.ready = true;
+				done.notify_all();
+			}
+		}
+		else if (bonusRequest.wanted >= 0 && !bonusRequest.ready) {
+			Request request = bonusRequest;
+			std::mt19937 rng = generatorFor(BONUS, request.serial);
+
+			lock.unlock();
+			buildBonus(request.wanted, rng, bonusScratch);
+			lock.lock();
+
+			if (builtFor == generation && bonusRequest.wanted == request.wanted && bonusRequest.serial == request.serial) {
+				std::swap(bonus, bonusScratch);
+				bonusRequest.ready = true;
+				done.notify_all();
+			}
+		}
+		else {
+			uint32_t serial = nextLineSerial;
+			std::mt19937 rng = generatorFor(LINE, serial);
+			Weakness stamped = weaknessForLine(serial); // Copied, the game may set a new one while this builds
+
+			lock.unlock();
+			buildLine(rng, stamped, lineScratch);
+			lock.lock();
+
+			// The scratch buffer takes the slot's old buffer (the one takeLine handed back)
+			if (builtFor == generation && serial == nextLineSerial) {
+				std::swap(lines[(lineHead + lineCount) % LINE_QUEUE], lineScratch);
+				lineCount++;
+				nextLineSerial++;
+				done.notify_all();
+			}
+		}
+	}
+}
+
+std::mt19937 ContentPrefetcher::generatorFor(Kind kind, uint32_t serial) const
+{
+	std::seed_seq sequence{ baseSeed, static_cast<uint32_t>(kind), serial };
+	return std::mt19937(sequence);
+}
+
+// Latest weakness that starts at or before this line, called with the lock held
+const ContentPrefetcher::Weakness& ContentPrefetcher::weaknessForLine(uint32_t serial) const
+{
+	size_t i = lineWeakness.size() - 1;
+	while (i > 0 && lineWeakness[i].firstLine > serial) {
+		i--;
+	}
+	return lineWeakness[i].weakness;
+}
+
+// Samplers are only touched by whoever builds (the worker, or take* with the lock held when there's none)
+AdaptiveSampler& ContentPrefetcher::samplerFor(WordListManager::Difficulty difficulty, const Weakness& weakness)
+{
+	AdaptiveSampler& sampler = samplers[difficulty];
+	if (!sampler.isBuilt()) {
+		sampler.build(words->getList(difficulty));
+	}
+	sampler.setWeakness(weakness.values);
+	return sampler;
+}
+
+void ContentPrefetcher::buildLine(std::mt19937& rng, const Weakness& weakness, std::string& line)
+{
+	line.clear();
+
+	const WordList& list = words->getList(WordListManager::WPM);
+	if (list.empty()) {
+		return;
+	}
+
+	AdaptiveSampler& sampler = samplerFor(WordListManager::WPM, weakness);
+	for (size_t i = 0; i < LINE_WORDS; ++i) {
+		if (i > 0) {
+			line += ' ';
+		}
+		line += list[sampler.draw(rng)];
+	}
+}
+
+// Same rules nextLevel always used: a zombie more every 5 levels, difficulty cycling every 30
+void ContentPrefetcher::buildWave(int level, std::mt19937& rng, const Weakness& weakness, WavePlan& plan)
+{
+	int numZombies = 3 + (level / 5);
+	int cycleLevel = (level % 30) + 1;
+
+	if (cycleLevel <= 10) {
+		plan.difficulty = WordListManager::EASY;
+	}
+	else if (cycleLevel <= 20) {
+		plan.difficulty = WordListManager::MEDIUM;
+	}
+	else {
+		plan.difficulty = WordListManager::HARD;
+	}
+
+	const WordList& list = words->getList(plan.difficulty);
+	plan.words.resize(numZombies);
+	if (!list.empty()) {
+		AdaptiveSampler& sampler = samplerFor(plan.difficulty, weakness);
+		for (std::string& word : plan.words) {
+			word.assign(list[sampler.draw(rng)]);
+		}
+	}
+
+	// Random off-screen positions, not too close to the player or each other
+	int spawnBuffer = 150; // Distance beyond game window for spawning
+	std::uniform_int_distribution<int> pickEdge(0, 2); // 0: top, 1: left, 2: right
+	std::uniform_int_distribution<int> pickX(0, fieldWidth - 1);
+	std::uniform_int_distribution<int> pickY(0, 649); // Ensures zombies spawn above the barrier orb
+
+	plan.spawns.clear();
+	spawnGrid.clear();
+	for (int i = 0; i < numZombies; ++i) {
+		int spawnEdge = pickEdge(rng);
+		int x = 0, y = 0;
+		bool validSpawn = false;
+
+		while (!validSpawn) {
+			validSpawn = true;
+			switch (spawnEdge)
+			{
+			case 0: // Top
+				x = pickX(rng);
+				y = -spawnBuffer;
+				break;
+			case 1: // Left
+				x = -spawnBuffer;
+				y = pickY(rng);
+				break;
+			case 2: // Right
+				x = fieldWidth + spawnBuffer;
+				y = pickY(rng);
+				break;
+			}
+
+			float dx = playerX - x;
+			float dy = playerY - y;
+			if (std::sqrt(dx * dx + dy * dy) < 400.0f) {
+				validSpawn = false;
+				continue;
+			}
+
+			// Check distance to the spawns placed so far (only the ones in nearby grid cells)
+			if (spawnGrid.anyWithin(static_cast<float>(x), static_cast<float>(y), 70.0f)) { // Radius for how far zombies spawn from each other
+				validSpawn = false;
+			}
+		}
+
+		plan.spawns.push_back({ x, y });
+		spawnGrid.insert(nullptr, SDL_Rect{ x, y, 0, 0 });
+	}
+}
+
+void ContentPrefetcher::buildBonus(int bonusLevel, std::mt19937& rng, BonusPlan& plan) const
+{
+	// Both rows grow by one zombie each bonus round
+	int numZombies = 3 + (bonusLevel - 1);
+
+	const WordList& left = words->getList(WordListManager::BONUSLEFT);
+	const WordList& right = words->getList(WordListManager::BONUSRIGHT);
+
+	plan.leftWords.resize(numZombies);
+	plan.rightWords.resize(numZombies);
+	if (!left.empty()) {
+		std::uniform_int_distribution<size_t> pick(0, left.size() - 1);
+		for (std::string& word : plan.leftWords) {
+			word.assign(left[pick(rng)]);
+		}
+	}
+	if (!right.empty()) {
+		std::uniform_int_distribution<size_t> pick(0, right.size() - 1);
+		for (std::string& word : plan.rightWords) {
+			word.assign(right[pick(rng)]);
+		}
+	}
+
+	std::uniform_int_distribution<int> pickRow(150, 509);
+	plan.yLeft = pickRow(rng);
+	plan.yRight = pickRow(rng);
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <random>
+#include <cstdint>
+#include "SDL.h"
+#include "WordListManager.h"
+#include "AdaptiveSampler.h"
+#include "SpatialHash.h"
+
+// Words and spawn spots for one arcade wave
+struct WavePlan {
+	WordListManager::Difficulty difficulty = WordListManager::EASY;
+	std::vector<std::string> words;
+	std::vector<SDL_Point> spawns; // Top-left corner for each word's zombie
+};
+
+// Words and row heights for one bonus stage
+struct BonusPlan {
+	std::vector<std::string> leftWords;
+	std::vector<std::string> rightWords;
+	int yLeft = 0;
+	int yRight = 0;
+};
+
+// Prepares upcoming WPM lines, arcade waves and bonus stages on a worker thread, so a transition only swaps in the result.
+// Each result gets its own generator seeded from (seed, kind, request number) and is stamped with the weakness it has to use
+// (see setWeakness), so the output doesn't depend on thread timing.
+class ContentPrefetcher
+{
+public:
+	static constexpr size_t LINE_QUEUE = 4;  // WPM lines kept ready ahead of the player
+	static constexpr size_t LINE_WORDS = 12; // May need to adjust count so it doesn't overflow!
+
+	~ContentPrefetcher();
+
+	// Spawns keep away from the player at (playerX, playerY) and spread across fieldWidth
+	void start(const WordListManager* words, float playerX, float playerY, int fieldWidth);
+	void stop();
+
+	// Throw away everything prepared and start over from this seed
+	void seed(uint32_t value);
+
+	// Weak characters (0..1 each, see AdaptiveSampler). Waves asked for from now on use them, and so do WPM lines past
+	// the LINE_QUEUE already promised (those are prepared, or may be, with the old ones)
+	void setWeakness(const float* values);
+
+	// Swap the next line into line, its old buffer goes back to be refilled
+	void takeLine(std::string& line);
+
+	// Ask ahead of time, take only waits if the plan isn't finished yet (or was never asked for)
+	void requestWave(int level);
+	void takeWave(int level, WavePlan& plan);
+	void requestBonus(int bonusLevel);
+	void takeBonus(int bonusLevel, BonusPlan& plan);
+
+private:
+	enum Kind : uint32_t { LINE, WAVE, BONUS };
+
+	struct Weakness {
+		float values[AdaptiveSampler::CHARACTERS] = {};
+	};
+
+	struct Request {
+		int wanted = -1;     // Level asked for, -1 if nothing is
+		uint32_t serial = 0; // Which request this is, part of the generator seed
+		bool ready = false;
+		Weakness weakness;   // As it was when asked for (waves only, bonus rows aren't weighted)
+	};
+
+	// A weakness and the first WPM line it applies to
+	struct LineWeakness {
+		uint32_t firstLine = 0;
+		Weakness weakness;
+	};
+
+	void run();
+	std::mt19937 generatorFor(Kind kind, uint32_t serial) const;
+	const Weakness& weaknessForLine(uint32_t serial) const;
+	AdaptiveSampler& samplerFor(WordListManager::Difficulty difficulty, const Weakness& weakness);
+	void buildLine(std::mt19937& rng, const Weakness& weakness, std::string& line);
+	void buildWave(int level, std::mt19937& rng, const Weakness& weakness, WavePlan& plan);
+	void buildBonus(int bonusLevel, std::mt19937& rng, BonusPlan& plan) const;
+
+	const WordListManager* words = nullptr;
+	float playerX = 0.0f;
+	float playerY = 0.0f;
+	int fieldWidth = 1600;
+	SpatialHash spawnGrid; // Spawns placed so far in the wave being built, worker only
+
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable wake; // Worker sleeps on this until there's something to build
+	std::condition_variable done; // take* sleeps on this until its result is in
+	bool stopping = false;
+	uint32_t baseSeed = std::random_device{}();
+	uint32_t generation = 0; // Bumped by seed(), anything built for an older one is dropped
+
+	// Latest weakness set by the game, and the ones lines still to be built use (oldest first, never empty)
+	Weakness weakness;
+	std::vector<LineWeakness> lineWeakness{ LineWeakness() };
+	AdaptiveSampler samplers[WordListManager::LIST_COUNT]; // Built the first time a list is drawn from, worker only
+
+	// Ready lines sit in a ring starting at lineHead
+	std::string lines[LINE_QUEUE];
+	size_t lineHead = 0;
+	size_t lineCount = 0;
+	uint32_t nextLineSerial = 0;
+	uint32_t linesTaken = 0;
+	std::string lineScratch;
+
+	Request waveRequest;
+	uint32_t waveRequests = 0;
+	WavePlan wave, waveScratch;
+
+	Request bonusRequest;
+	uint32_t bonusRequests = 0;
+	BonusPlan bonus, bonusScratch;
+};
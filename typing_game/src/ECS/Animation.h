@@ -1,4 +1,7 @@
 #pragma once
+#include <array>
+#include <string>
+#include <unordered_map>
 
 struct Animation
 {
@@ -15,4 +18,56 @@ struct Animation
 		speed = s;
 		loop = l;
 	}
-};
\ No newline at end of file
+};
+
+// Clip IDs shared by every sprite sheet (a sheet only fills in the clips it has)
+enum AnimationID {
+	ANIM_WALK_DOWN,
+	ANIM_ATTACK_DOWN,
+	ANIM_WALK_RIGHT,
+	ANIM_ATTACK_RIGHT,
+	ANIM_WALK_LEFT,
+	ANIM_ATTACK_LEFT,
+	ANIM_DEFEAT,
+	ANIM_STUN,
+	ANIM_LASER,
+	ANIM_COUNT
+};
+
+// All clips of one sprite sheet, built once and shared by every sprite using that sheet
+struct AnimationTable
+{
+	std::array<Animation, ANIM_COUNT> clips{}; // Missing clips have 0 frames
+	AnimationID defaultClip = ANIM_WALK_DOWN;
+
+	bool has(AnimationID id) const { return clips[id].frames > 0; }
+
+	// Table registered for exactly this sheet path, or nullptr if there isn't one.
+	// A new animated sheet has to be added here under the same path the sprite loads.
+	static const AnimationTable* forSheet(const char* path)
+	{
+		static const std::unordered_map<std::string, AnimationTable> tables = [] {
+			AnimationTable zombie;
+			zombie.clips[ANIM_WALK_DOWN] = Animation(0, 4, 100);
+			zombie.clips[ANIM_ATTACK_DOWN] = Animation(1, 4, 100);
+			zombie.clips[ANIM_WALK_RIGHT] = Animation(2, 4, 100);
+			zombie.clips[ANIM_ATTACK_RIGHT] = Animation(3, 6, 70);
+			zombie.clips[ANIM_WALK_LEFT] = Animation(4, 4, 100);
+			zombie.clips[ANIM_ATTACK_LEFT] = Animation(5, 6, 70);
+			zombie.clips[ANIM_DEFEAT] = Animation(6, 19, 100, false);
+			zombie.clips[ANIM_STUN] = Animation(7, 8, 100);
+
+			AnimationTable laser;
+			laser.clips[ANIM_LASER] = Animation(0, 3, 80);
+			laser.defaultClip = ANIM_LASER;
+
+			return std::unordered_map<std::string, AnimationTable>{
+				{ "assets/Zambie-Sheet.png", zombie },
+				{ "assets/Laser-Sheet.png", laser },
+			};
+		}();
+
+		auto it = tables.find(path);
+		return it != tables.end() ? &it->second : nullptr;
+	}
+};
@@ -2,6 +2,7 @@
 #include <string>
 #include "SDL.h"
 #include "Components.h"
+#include "../SpatialHash.h"
 
 class ColliderComponent : public Component
 {
@@ -11,11 +12,28 @@ public:
 
 	TransformComponent* transform;
 
+	// Grid this collider is filed in, if any (kept in sync on update)
+	SpatialHash* grid = nullptr;
+	int proxy = -1;
+
 	ColliderComponent(std::string t)
 	{
 		tag = t;
 	}
 
+	~ColliderComponent()
+	{
+		if (grid) grid->remove(proxy);
+	}
+
+	void setGrid(SpatialHash* spatialHash)
+	{
+		if (grid) grid->remove(proxy);
+
+		grid = spatialHash;
+		if (grid) proxy = grid->insert(entity, collider);
+	}
+
 	void init() override
 	{
 		if (!entity->hasComponent<TransformComponent>())
@@ -23,6 +41,7 @@ public:
 			entity->addComponent<TransformComponent>();
 		}
 		transform = &entity->getComponent<TransformComponent>();
+		update();
 	}
 
 	void update() override
@@ -31,5 +50,7 @@ public:
 		collider.y = static_cast<int>(transform->position.y);
 		collider.w = transform->width * transform->scale;
 		collider.h = transform->height * transform->scale;
+
+		if (grid) grid->move(proxy, collider);
 	}
 };
\ No newline at end of file
@@ -3,31 +3,84 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
-#include <bitset>
+#include <tuple>
+#include <type_traits>
 #include <array>
+#include <deque>
+#include <new>
+#include <cstdint>
 
 // Entity Component System
 
 class Component;
 class Entity;
+class Manager;
+template <typename... Ts> class View;
+
+// Refers to an entity by slot and generation instead of by address.
+// Once the entity is removed (and its slot maybe reused) the handle just reads as empty.
+class EntityHandle
+{
+private:
+	Manager* manager = nullptr;
+	std::uint32_t index = 0;
+	std::uint32_t generation = 0;
+
+public:
+	EntityHandle() = default;
+	EntityHandle(Manager* mManager, std::uint32_t mIndex, std::uint32_t mGeneration)
+		: manager(mManager), index(mIndex), generation(mGeneration) {}
+
+	// nullptr if the entity has been removed. This is the only way in, so every use has to check:
+	//   if (Entity* e = handle.get()) { ... }
+	Entity* get() const;
+
+	explicit operator bool() const { return get() != nullptr; }
+
+	void reset() { manager = nullptr; }
+
+	bool operator==(const EntityHandle& other) const = default;
+};
+
+// Every component type, in update order. A new component class has to be added here.
+class TransformComponent;
+class ColliderComponent;
+class SpriteComponent;
+class TransformStatusComponent;
+
+template <typename... Ts> struct TypeList {};
+
+using ComponentList = TypeList<TransformComponent, ColliderComponent, SpriteComponent, TransformStatusComponent>;
 
 using ComponentID = std::size_t;
+using ComponentMask = std::uint32_t;
 
-inline ComponentID getComponentTypeID()
-{
-	static ComponentID lastID = 0;
-	return lastID++;
-}
+template <typename T, typename List> struct TypeIndex;
 
-template <typename T> inline ComponentID getComponentTypeID() noexcept
+template <typename T>
+struct TypeIndex<T, TypeList<>>
 {
-	static ComponentID typeID = getComponentTypeID();
-	return typeID;
-}
+	static_assert(!std::is_same_v<T, T>, "Component type is missing from ComponentList");
+};
 
-constexpr std::size_t maxComponents = 32;
+template <typename T, typename... Ts>
+struct TypeIndex<T, TypeList<T, Ts...>> : std::integral_constant<std::size_t, 0> {};
+
+template <typename T, typename U, typename... Ts>
+struct TypeIndex<T, TypeList<U, Ts...>> : std::integral_constant<std::size_t, 1 + TypeIndex<T, TypeList<Ts...>>::value> {};
+
+template <typename List> struct TypeCount;
+template <typename... Ts> struct TypeCount<TypeList<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+// Fixed at compile time, so lookups are a plain array index
+template <typename T> constexpr ComponentID componentID = TypeIndex<T, ComponentList>::value;
+
+// Bits for a set of component types, entities match when their signature contains all of them
+template <typename... Ts> constexpr ComponentMask componentMask = ((ComponentMask(1) << componentID<Ts>) | ... | ComponentMask(0));
+
+constexpr std::size_t maxComponents = TypeCount<ComponentList>::value;
+static_assert(maxComponents <= sizeof(ComponentMask) * 8, "Too many component types for ComponentMask");
 
-using ComponentBitSet = std::bitset<maxComponents>;
 using ComponentArray = std::array<Component*, maxComponents>;
 
 class Component
@@ -42,86 +95,396 @@ public:
 	virtual ~Component() {}
 };
 
+// Lets Manager run and free a pool's components without knowing their type
+class ComponentPoolBase
+{
+public:
+	virtual ~ComponentPoolBase() {}
+
+	virtual void updateAll() = 0;
+	virtual void drawAll() = 0;
+	virtual void destroy(Component* c) = 0;
+};
+
+// Every component of one type, stored contiguously in fixed-size chunks so they never move once created.
+// Freed slots get reused, and update/draw walk the chunks in order with non-virtual calls.
+template <typename T>
+class ComponentPool : public ComponentPoolBase
+{
+private:
+	static constexpr std::size_t chunkSize = 64;
+
+	struct Slot
+	{
+		alignas(T) unsigned char storage[sizeof(T)]; // Must stay first, destroy() relies on it
+		bool alive = false;
+	};
+
+	std::vector<std::unique_ptr<Slot[]>> chunks;
+	std::vector<Slot*> freeSlots;
+	std::size_t used = 0; // Slots handed out so far (live or free)
+	std::size_t count = 0;
+
+	Slot& slotAt(std::size_t i) { return chunks[i / chunkSize][i % chunkSize]; }
+	static T* object(Slot& slot) { return std::launder(reinterpret_cast<T*>(slot.storage)); }
+
+public:
+	ComponentPool() = default;
+	ComponentPool(const ComponentPool&) = delete;
+	ComponentPool& operator=(const ComponentPool&) = delete;
+
+	~ComponentPool()
+	{
+		for (std::size_t i = 0; i < used; i++) {
+			Slot& slot = slotAt(i);
+			if (slot.alive) {
+				object(slot)->~T();
+			}
+		}
+	}
+
+	template <typename... TArgs>
+	T* create(TArgs&&... mArgs)
+	{
+		Slot* slot;
+		if (!freeSlots.empty()) {
+			slot = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else {
+			if (used == chunks.size() * chunkSize) {
+				chunks.emplace_back(new Slot[chunkSize]);
+			}
+			slot = &slotAt(used++);
+		}
+
+		T* c = new (slot->storage) T(std::forward<TArgs>(mArgs)...);
+		slot->alive = true;
+		count++;
+		return c;
+	}
+
+	void destroy(Component* c) override
+	{
+		T* typed = static_cast<T*>(c);
+		Slot* slot = reinterpret_cast<Slot*>(typed);
+
+		typed->~T();
+		slot->alive = false;
+		freeSlots.push_back(slot);
+		count--;
+	}
+
+	void updateAll() override
+	{
+		for (std::size_t i = 0; i < used; i++) {
+			Slot& slot = slotAt(i);
+			if (slot.alive) {
+				object(slot)->T::update();
+			}
+		}
+	}
+
+	void drawAll() override
+	{
+		for (std::size_t i = 0; i < used; i++) {
+			Slot& slot = slotAt(i);
+			if (slot.alive) {
+				object(slot)->T::draw();
+			}
+		}
+	}
+
+	template <typename F>
+	void forEach(F&& fn)
+	{
+		for (std::size_t i = 0; i < used; i++) {
+			Slot& slot = slotAt(i);
+			if (slot.alive) {
+				fn(*object(slot));
+			}
+		}
+	}
+
+	std::size_t size() const { return count; }
+};
+
 class Entity
 {
 private:
+	friend class Manager;
+
+	Manager& manager;
+	std::uint32_t index;
+	std::uint32_t generation = 0; // Bumped every time the slot is freed, invalidating old handles
 	bool active = true;
-	std::vector<std::unique_ptr<Component>> components;
 
-	ComponentArray componentArray;
-	ComponentBitSet componentBitSet;
+	ComponentArray componentArray{};
+	ComponentMask signature = 0;
 
 public:
+	Entity(Manager& mManager, std::uint32_t mIndex) : manager(mManager), index(mIndex) {}
+	Entity(const Entity&) = delete;
+	Entity& operator=(const Entity&) = delete;
+
 	void update()
 	{
-		for (auto& c : components) c->update();
+		for (std::size_t i = 0; i < maxComponents; i++) {
+			if (componentArray[i]) componentArray[i]->update();
+		}
 	}
 
 	void draw()
 	{
-		for (auto& c : components) c->draw();
+		for (std::size_t i = 0; i < maxComponents; i++) {
+			if (componentArray[i]) componentArray[i]->draw();
+		}
 	}
-	
+
 	bool isActive() const { return active; }
 
-	void destroy() { active = false; }
+	// Marks the entity for removal on the next refresh
+	void destroy();
 
-	template <typename T> bool hasComponent() const
+	EntityHandle handle();
+
+	ComponentMask getSignature() const { return signature; }
+
+	template <typename... Ts> bool hasComponents() const
 	{
-		return componentBitSet[getComponentTypeID<T>()];
+		return (signature & componentMask<Ts...>) == componentMask<Ts...>;
 	}
 
-	template <typename T, typename... TArgs>
-	T& addComponent(TArgs&&... mArgs)
+	template <typename T> bool hasComponent() const
 	{
-		T* c(new T(std::forward<TArgs>(mArgs)...));
-		c->entity = this;
-		std::unique_ptr<Component> uPtr{ c };
-		components.emplace_back(std::move(uPtr));
+		return hasComponents<T>();
+	}
 
-		componentArray[getComponentTypeID<T>()] = c;
-		componentBitSet[getComponentTypeID<T>()] = true;
+	// Defined after Manager, since components live in the manager's pools
+	template <typename T, typename... TArgs>
+	T& addComponent(TArgs&&... mArgs);
 
-		c->init();
-		return *c;
-	}
 	template<typename T> T& getComponent() const
 	{
-		auto ptr(componentArray[getComponentTypeID<T>()]);
+		auto ptr(componentArray[componentID<T>]);
 		return *static_cast<T*>(ptr);
 	}
+
+	void removeComponents();
 };
 
 class Manager
 {
 private:
-	std::vector<std::unique_ptr<Entity>> entities;
+	// Deque so entities never move, freed slots are reused through freeEntities
+	std::deque<Entity> entities;
+	std::vector<std::uint32_t> freeEntities;
+	std::vector<std::uint32_t> pendingDestroy;
+	std::array<std::unique_ptr<ComponentPoolBase>, maxComponents> pools;
+
 
 public:
+	Manager() = default;
+	Manager(const Manager&) = delete;
+	Manager& operator=(const Manager&) = delete;
+
+	// Systems run per component type, over each type's contiguous pool
 	void update()
 	{
-		for (auto& e : entities) e->update();
+		for (auto& pool : pools) {
+			if (pool) pool->updateAll();
+		}
 	}
 	void draw()
 	{
-		for (auto& e : entities) e->draw();
+		for (auto& pool : pools) {
+			if (pool) pool->drawAll();
+		}
 	}
 
+	// Frees entities destroyed since the last refresh, nothing to do on most frames
 	void refresh()
 	{
-		entities.erase(std::remove_if(std::begin(entities), std::end(entities),
-			[](const std::unique_ptr<Entity>& mEntity)
-			{
-				return !mEntity->isActive();
-			}),
-			std::end(entities));
+		for (std::uint32_t index : pendingDestroy) {
+			Entity& e = entities[index];
+			e.removeComponents();
+			e.generation++;
+			freeEntities.push_back(index);
+		}
+		pendingDestroy.clear();
 	}
 
 	Entity& addEntity()
 	{
-		Entity* e = new Entity();
-		std::unique_ptr<Entity> uPtr{ e };
-		entities.emplace_back(std::move(uPtr));
-		return *e;
+		if (!freeEntities.empty()) {
+			Entity& e = entities[freeEntities.back()];
+			freeEntities.pop_back();
+			e.active = true;
+			return e;
+		}
+
+		return entities.emplace_back(*this, static_cast<std::uint32_t>(entities.size()));
 	}
+
+	Entity* getEntity(std::uint32_t index, std::uint32_t generation)
+	{
+		if (index >= entities.size()) return nullptr;
+
+		Entity& e = entities[index];
+		return e.generation == generation ? &e : nullptr;
+	}
+
+	void queueDestroy(std::uint32_t index) { pendingDestroy.push_back(index); }
+
+	std::size_t getEntityCount() const { return entities.size() - freeEntities.size(); }
+
+	// The live entities among the given handles (in their order) that have all of Ts
+	template <typename... Ts> View<Ts...> view(const std::vector<EntityHandle>& handles);
+
+	template <typename T> ComponentPool<T>& getPool()
+	{
+		auto& pool = pools[componentID<T>];
+		if (!pool) {
+			pool = std::make_unique<ComponentPool<T>>();
+		}
+		return static_cast<ComponentPool<T>&>(*pool);
+	}
+
+	void destroyComponent(ComponentID id, Component* c)
+	{
+		pools[id]->destroy(c);
+	}
+};
+
+// Entities among a list of handles that match a set of component types, iterated as (entity, components...)
+// so loop bodies don't have to look the components up again:
+//   for (auto [e, transform, sprite] : manager.view<TransformComponent, SpriteComponent>(handles)) { ... }
+// indexed() also yields each one's position in the list, for data kept alongside it (words, ranks):
+//   for (auto [i, e, transform] : manager.view<TransformComponent>(handles).indexed()) { ... }
+template <typename... Ts>
+class View
+{
+private:
+	const std::vector<EntityHandle>& handles;
+
+	// The entity at pos if it's still around and matches, nullptr otherwise
+	Entity* match(std::size_t pos) const
+	{
+		Entity* e = handles[pos].get();
+		return (e && e->hasComponents<Ts...>()) ? e : nullptr;
+	}
+
+	template <bool WithIndex>
+	class BasicIterator
+	{
+	private:
+		const View* view;
+		std::size_t pos;
+		Entity* current = nullptr;
+
+		void seek()
+		{
+			std::size_t end = view->handles.size();
+			while (pos < end && !(current = view->match(pos))) {
+				pos++;
+			}
+		}
+
+	public:
+		BasicIterator(const View* mView, std::size_t mPos) : view(mView), pos(mPos) { seek(); }
+
+		auto operator*() const
+		{
+			if constexpr (WithIndex) {
+				return std::tuple<std::size_t, Entity&, Ts&...>{ pos, *current, current->template getComponent<Ts>()... };
+			}
+			else {
+				return std::tuple<Entity&, Ts&...>{ *current, current->template getComponent<Ts>()... };
+			}
+		}
+
+		BasicIterator& operator++()
+		{
+			pos++;
+			seek();
+			return *this;
+		}
+
+		bool operator!=(const BasicIterator& other) const { return pos != other.pos; }
+	};
+
+	// Holds its own copy of the view (just a reference to the list), so it's safe as the range of a for loop
+	struct Indexed
+	{
+		View view;
+
+		BasicIterator<true> begin() const { return BasicIterator<true>(&view, 0); }
+		BasicIterator<true> end() const { return BasicIterator<true>(&view, view.handles.size()); }
+	};
+
+public:
+	explicit View(const std::vector<EntityHandle>& mHandles) : handles(mHandles) {}
+
+	using Iterator = BasicIterator<false>;
+
+	Iterator begin() const { return Iterator(this, 0); }
+	Iterator end() const { return Iterator(this, handles.size()); }
+
+	// Same entities, same order, as (position in the handle list, entity, components...)
+	Indexed indexed() const { return Indexed{ *this }; }
 };
+
+template <typename... Ts>
+View<Ts...> Manager::view(const std::vector<EntityHandle>& handles)
+{
+	return View<Ts...>(handles);
+}
+
+inline Entity* EntityHandle::get() const
+{
+	return manager ? manager->getEntity(index, generation) : nullptr;
+}
+
+inline void Entity::destroy()
+{
+	if (!active) return;
+
+	active = false;
+	manager.queueDestroy(index);
+}
+
+inline EntityHandle Entity::handle()
+{
+	return EntityHandle(&manager, index, generation);
+}
+
+template <typename T, typename... TArgs>
+T& Entity::addComponent(TArgs&&... mArgs)
+{
+	constexpr ComponentID id = componentID<T>;
+
+	// One component of each type per entity, adding it again replaces the old one
+	if (componentArray[id]) {
+		manager.destroyComponent(id, componentArray[id]);
+	}
+
+	T* c = manager.getPool<T>().create(std::forward<TArgs>(mArgs)...);
+	c->entity = this;
+
+	componentArray[id] = c;
+	signature |= componentMask<T>;
+
+	c->init();
+	return *c;
+}
+
+inline void Entity::removeComponents()
+{
+	for (std::size_t i = 0; i < maxComponents; i++) {
+		if (componentArray[i]) {
+			manager.destroyComponent(i, componentArray[i]);
+			componentArray[i] = nullptr;
+		}
+	}
+	signature = 0;
+}
@@ -1,15 +1,25 @@
 #pragma once
+#include <cstdlib>
+#include <iostream>
 #include "Components.h"
 #include "SDL.h"
 #include "../TextureManager.h"
 #include "Animation.h"
-#include <map>
+
+// Draw order inside a sprite batch (lowest first)
+enum SpriteLayer {
+	LAYER_BACKGROUND,
+	LAYER_GROUND,
+	LAYER_ACTORS,
+	LAYER_EFFECTS,
+	LAYER_UI
+};
 
 class SpriteComponent : public Component
 {
 private:
 	TransformComponent *transform;
-	SDL_Texture *texture;
+	SDL_Texture *texture = nullptr;
 	SDL_Rect srcRect, destRect;
 	Uint32 animationStartTime = 0;
 
@@ -22,8 +32,10 @@ private:
 public:
 
 	int animIndex = 0;
+	int layer = LAYER_ACTORS;
 
-	std::map<const char*, Animation> animations;
+	const AnimationTable* animations = nullptr;
+	int currentClip = -1;
 
 	SpriteComponent() = default;
 	SpriteComponent(const char* path)
@@ -35,49 +47,68 @@ public:
 	{
 		animated = isAnimated;
 
-		// Zombie animations
-		Animation walkDown = Animation(0, 4, 100);
-		Animation attackDown = Animation(1, 4, 100);
-		Animation walkRight = Animation(2, 4, 100);
-		Animation attackRight = Animation(3, 6, 70);
-		Animation walkLeft = Animation(4, 4, 100);
-		Animation attackLeft = Animation(5, 6, 70);
-		Animation defeat = Animation(6, 19, 100, false);
-		Animation stun = Animation(7, 8, 100);
-
-		animations.emplace("Walk Down", walkDown);
-		animations.emplace("Attack Down", attackDown);
-		animations.emplace("Walk Right", walkRight);
-		animations.emplace("Attack Right", attackRight);
-		animations.emplace("Walk Left", walkLeft);
-		animations.emplace("Attack Left", attackLeft);
-		animations.emplace("Defeat", defeat);
-		animations.emplace("Stun", stun);
-		
-		// Laser
-		Animation laser = Animation(0, 3, 80);
-		animations.emplace("Laser", laser);
-
-		Play("Walk Down");
-
-		//frames = nFrames;
-		//speed = mSpeed;
+		// Clips come from the sheet's shared table, nothing is built per sprite
+		animations = AnimationTable::forSheet(path);
+		if (!animations) {
+			// Guessing a table would play the wrong frames, so stop right here
+			std::cerr << "No animation table registered for " << path << std::endl;
+			std::abort();
+		}
+		Play(animations->defaultClip);
+
 		setTex(path);
 	}
 
 	// Deconstructor
 	~SpriteComponent()
 	{
-		SDL_DestroyTexture(texture);
+		TextureManager::Release(texture);
+	}
+
+	void setLayer(int spriteLayer) {
+		layer = spriteLayer;
 	}
 
 	void setFrames(int framess) {
 		frames = framess;
 	}
 
+	SDL_Texture* getTexture() const { return texture; }
+	const SDL_Rect& getDestRect() const { return destRect; }
+	bool isLooping() const { return loop; }
+
+	// Source rect of the current clip's last frame (where a one-shot clip like "Defeat" comes to rest)
+	SDL_Rect getLastFrameRect() const
+	{
+		SDL_Rect last = srcRect;
+		last.x = srcRect.w * (frames - 1);
+		return last;
+	}
+
 	void setTex(const char* path)
 	{
-		texture = TextureManager::LoadTexture(path);
+		// Grab the new one before letting go of the old, so re-setting the same path never reloads it
+		SDL_Texture* newTexture = TextureManager::LoadTexture(path);
+		TextureManager::Release(texture);
+		texture = newTexture;
+	}
+
+	// Pick up the new texture after TextureManager::ReloadAll (device reset)
+	void reloadTexture()
+	{
+		texture = TextureManager::Reloaded(texture);
+	}
+
+	// Swap to an already loaded texture (no lookup or file I/O)
+	void setTexture(SDL_Texture* newTexture)
+	{
+		if (newTexture == texture) {
+			return;
+		}
+
+		TextureManager::Retain(newTexture);
+		TextureManager::Release(texture);
+		texture = newTexture;
 	}
 
 	void init() override
@@ -116,7 +147,14 @@ public:
 
 	void draw() override
 	{
-		TextureManager::Draw(texture, srcRect, destRect);
+		// Frames can land between simulation ticks, draw where the sprite is partway through its move
+		if (Game::renderAlpha < 1.0f) {
+			Vector2D drawPosition = transform->interpolated(Game::renderAlpha);
+			destRect.x = static_cast<int>(drawPosition.x);
+			destRect.y = static_cast<int>(drawPosition.y);
+		}
+
+		TextureManager::Draw(texture, srcRect, destRect, layer);
 	}
 
 	// New render function for custom position rendering
@@ -124,17 +162,23 @@ public:
 	{
 		destRect.x = x;
 		destRect.y = y;
-		TextureManager::Draw(texture, srcRect, destRect);
+		TextureManager::Draw(texture, srcRect, destRect, layer);
 	}
 
-	void Play(const char* animName)
+	// Does nothing if the clip is already playing (or the sheet doesn't have it), so it's safe to call every frame
+	void Play(AnimationID id)
 	{
-		const Animation& anim = animations[animName];
+		if (id == currentClip || !animations || !animations->has(id)) {
+			return;
+		}
+
+		const Animation& anim = animations->clips[id];
 		frames = anim.frames;
 		animIndex = anim.index;
 		speed = anim.speed;
 		loop = anim.loop;
 		currentFrame = 0;
+		currentClip = id;
 
 		animationStartTime = SDL_GetTicks();
 	}
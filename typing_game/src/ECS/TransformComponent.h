@@ -7,6 +7,7 @@ class TransformComponent : public Component
 public:
 
 	Vector2D position;
+	Vector2D previousPosition; // Where it was at the start of the current tick, for interpolated drawing
 	Vector2D velocity;
 
 	int width = 32;
@@ -44,6 +45,19 @@ public:
 	void init() override
 	{
 		velocity.Zero();
+		previousPosition = position;
+	}
+
+	void savePrevious()
+	{
+		previousPosition = position;
+	}
+
+	// Position blended between the last two ticks (alpha 1 is the latest)
+	Vector2D interpolated(float alpha) const
+	{
+		return Vector2D(previousPosition.x + (position.x - previousPosition.x) * alpha,
+			previousPosition.y + (position.y - previousPosition.y) * alpha);
 	}
 	void update() override
 	{
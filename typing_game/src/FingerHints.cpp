@@ -0,0 +1,68 @@
+#include "FingerHints.h"
+#include "TextureManager.h"
+
+namespace {
+	const char* leftPaths[] = {
+		"assets/Left_Hand.png", "assets/Left_Pinky.png", "assets/Left_Ring.png",
+		"assets/Left_Middle.png", "assets/Left_Index.png", "assets/Left_Thumb.png"
+	};
+
+	const char* rightPaths[] = {
+		"assets/Right_Hand.png", "assets/Right_Pinky.png", "assets/Right_Ring.png",
+		"assets/Right_Middle.png", "assets/Right_Index.png", "assets/Right_Thumb.png"
+	};
+}
+
+// Key-to-finger mapping, built once (any key not listed keeps both hands resting)
+FingerHints::FingerHints()
+{
+	assign("qaz", HandPose::PINKY, HandPose::REST);
+	assign("wsx", HandPose::RING, HandPose::REST);
+	assign("edc", HandPose::MIDDLE, HandPose::REST);
+	assign("rfvtgb", HandPose::INDEX, HandPose::REST);
+
+	assign("yhnujm", HandPose::REST, HandPose::INDEX);
+	assign("ik,", HandPose::REST, HandPose::MIDDLE);
+	assign("ol.", HandPose::REST, HandPose::RING);
+	assign("p", HandPose::REST, HandPose::PINKY);
+
+	// Thumbs for space
+	assign(" ", HandPose::THUMB, HandPose::THUMB);
+}
+
+void FingerHints::assign(const char* keys, HandPose left, HandPose right)
+{
+	for (const char* key = keys; *key; ++key) {
+		table[static_cast<unsigned char>(*key)] = { left, right };
+	}
+}
+
+void FingerHints::load()
+{
+	for (int i = 0; i < static_cast<int>(HandPose::COUNT); i++) {
+		if (!leftTextures[i]) {
+			leftTextures[i] = TextureManager::LoadTexture(leftPaths[i]);
+		}
+		if (!rightTextures[i]) {
+			rightTextures[i] = TextureManager::LoadTexture(rightPaths[i]);
+		}
+	}
+}
+
+void FingerHints::reload()
+{
+	for (int i = 0; i < static_cast<int>(HandPose::COUNT); i++) {
+		leftTextures[i] = TextureManager::Reloaded(leftTextures[i]);
+		rightTextures[i] = TextureManager::Reloaded(rightTextures[i]);
+	}
+}
+
+void FingerHints::release()
+{
+	for (int i = 0; i < static_cast<int>(HandPose::COUNT); i++) {
+		TextureManager::Release(leftTextures[i]);
+		TextureManager::Release(rightTextures[i]);
+		leftTextures[i] = nullptr;
+		rightTextures[i] = nullptr;
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "SDL.h"
+#include <array>
+
+// Which hand sprite to show, one per finger (plus the resting hand)
+enum class HandPose : Uint8 { REST, PINKY, RING, MIDDLE, INDEX, THUMB, COUNT };
+
+struct FingerHint {
+	HandPose left = HandPose::REST;
+	HandPose right = HandPose::REST;
+};
+
+class FingerHints {
+public:
+	FingerHints();
+
+	// Loads every hand texture up front, so switching fingers is just a pointer swap
+	void load();
+	void release();
+	void reload(); // After TextureManager::ReloadAll
+
+	const FingerHint& hintFor(char c) const { return table[static_cast<unsigned char>(c)]; }
+
+	SDL_Texture* leftTexture(HandPose pose) const { return leftTextures[static_cast<int>(pose)]; }
+	SDL_Texture* rightTexture(HandPose pose) const { return rightTextures[static_cast<int>(pose)]; }
+
+private:
+	std::array<FingerHint, 256> table;
+	SDL_Texture* leftTextures[static_cast<int>(HandPose::COUNT)] = {};
+	SDL_Texture* rightTextures[static_cast<int>(HandPose::COUNT)] = {};
+
+	void assign(const char* keys, HandPose left, HandPose right);
+};
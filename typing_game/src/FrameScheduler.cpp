@@ -0,0 +1,124 @@
+#include "FrameScheduler.h"
+#include <thread>
+#include <iomanip>
+#include <string>
+
+// Leave this much of the wait to the spin loop, SDL_Delay can overshoot by about a millisecond
+constexpr double SPIN_MARGIN_MS = 1.5;
+
+FrameScheduler::FrameScheduler(int targetFPS)
+{
+	frequency = SDL_GetPerformanceFrequency();
+	setTargetFPS(targetFPS);
+}
+
+void FrameScheduler::setTargetFPS(int fps)
+{
+	targetFPS = fps > 0 ? fps : 0;
+	period = targetFPS > 0 ? frequency / targetFPS : 0;
+	nextDeadline = 0;
+}
+
+bool FrameScheduler::setVSync(SDL_Renderer* renderer, bool enabled)
+{
+	if (SDL_RenderSetVSync(renderer, enabled ? 1 : 0) != 0) {
+		std::cout << "Couldn't change vsync: " << SDL_GetError() << std::endl;
+		return false;
+	}
+
+	vsync = enabled;
+	nextDeadline = 0;
+	return true;
+}
+
+void FrameScheduler::beginFrame()
+{
+	Uint64 now = SDL_GetPerformanceCounter();
+
+	if (frameStart != 0) {
+		lastFrameMs = (now - frameStart) * 1000.0 / frequency;
+		totalFrameMs += lastFrameMs;
+		if (lastFrameMs > worstFrameMs) {
+			worstFrameMs = lastFrameMs;
+		}
+
+		int bucket = static_cast<int>(lastFrameMs / BUCKET_MS);
+		histogram[bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1]++;
+		frames++;
+	}
+
+	frameStart = now;
+}
+
+void FrameScheduler::waitForNextFrame()
+{
+	if (vsync || period == 0) {
+		SDL_PumpEvents();
+		return;
+	}
+
+	Uint64 now = SDL_GetPerformanceCounter();
+
+	// Deadlines step by exactly one period so rounding never adds up, unless we've fallen a whole frame behind
+	if (nextDeadline == 0 || now > nextDeadline + period) {
+		nextDeadline = now + period;
+	}
+	else {
+		nextDeadline += period;
+	}
+
+	// Coarse part: whole-millisecond sleeps
+	Uint64 spinMargin = static_cast<Uint64>(SPIN_MARGIN_MS * frequency / 1000.0);
+	while (now + spinMargin < nextDeadline) {
+		SDL_PumpEvents();
+		SDL_Delay(1);
+		now = SDL_GetPerformanceCounter();
+	}
+
+	// Fine part: spin out the rest, yielding so we don't starve other threads
+	SDL_PumpEvents();
+	while (SDL_GetPerformanceCounter() < nextDeadline) {
+		std::this_thread::yield();
+	}
+}
+
+double FrameScheduler::getPercentileMs(double fraction) const
+{
+	if (frames == 0) {
+		return 0.0;
+	}
+
+	Uint64 target = static_cast<Uint64>(frames * fraction);
+	Uint64 seen = 0;
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		seen += histogram[i];
+		if (seen > target) {
+			return (i + 1) * BUCKET_MS;
+		}
+	}
+
+	return HISTOGRAM_BUCKETS * BUCKET_MS;
+}
+
+void FrameScheduler::printStats(std::ostream& out) const
+{
+	out << "Frame pacing: " << frames << " frames, target " << (targetFPS > 0 ? std::to_string(targetFPS) : "uncapped")
+		<< (vsync ? " (vsync)" : "") << std::endl;
+
+	if (frames == 0) {
+		return;
+	}
+
+	out << std::fixed << std::setprecision(2)
+		<< "  avg " << totalFrameMs / frames << " ms, p50 " << getPercentileMs(0.5) << " ms, p95 " << getPercentileMs(0.95)
+		<< " ms, p99 " << getPercentileMs(0.99) << " ms, worst " << worstFrameMs << " ms" << std::endl;
+
+	// Only the buckets that were hit, so the output stays short
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		if (histogram[i] == 0) continue;
+
+		out << "  " << std::setw(6) << i * BUCKET_MS << (i == HISTOGRAM_BUCKETS - 1 ? "+ ms: " : " ms: ") << histogram[i] << std::endl;
+	}
+
+	out.unsetf(std::ios::fixed);
+}
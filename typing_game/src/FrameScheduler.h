@@ -0,0 +1,54 @@
+#pragma once
+#include "SDL.h"
+#include <array>
+#include <iostream>
+
+// Paces the main loop off the performance counter: sleeps in whole milliseconds while there's room,
+// then spins for the last stretch so frames start on time instead of whenever the OS wakes us.
+// Also keeps a histogram of frame times so pacing (and typing latency) can be checked.
+class FrameScheduler
+{
+public:
+	static constexpr int HISTOGRAM_BUCKETS = 100; // 0.25 ms each, the last one catches everything slower
+	static constexpr double BUCKET_MS = 0.25;
+
+	FrameScheduler(int targetFPS = 60);
+
+	// 0 runs uncapped
+	void setTargetFPS(int fps);
+	int getTargetFPS() const { return targetFPS; }
+
+	// With vsync the present call already waits for the display, so the scheduler only measures
+	bool setVSync(SDL_Renderer* renderer, bool enabled);
+	bool getVSync() const { return vsync; }
+
+	// Call at the top of every frame, records how long the previous one took
+	void beginFrame();
+
+	// Wait until the next frame is due, pumping events meanwhile so keystrokes get timestamped on time
+	void waitForNextFrame();
+
+	double getLastFrameMs() const { return lastFrameMs; }
+	Uint64 getFrameCount() const { return frames; }
+	const std::array<Uint64, HISTOGRAM_BUCKETS>& getHistogram() const { return histogram; }
+
+	// Frame time (ms) that the given fraction of frames came in under, e.g. 0.99 for p99
+	double getPercentileMs(double fraction) const;
+
+	void printStats(std::ostream& out) const;
+
+private:
+	int targetFPS = 60;
+	bool vsync = false;
+
+	Uint64 frequency;
+	Uint64 period = 0;       // Counter units per frame, 0 when uncapped
+	Uint64 nextDeadline = 0;
+	Uint64 frameStart = 0;
+
+	double lastFrameMs = 0.0;
+	double worstFrameMs = 0.0;
+	double totalFrameMs = 0.0;
+	Uint64 frames = 0;
+	std::array<Uint64, HISTOGRAM_BUCKETS> histogram{};
+};
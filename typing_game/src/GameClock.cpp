@@ -0,0 +1,38 @@
+#include "GameClock.h"
+
+// A frame that stalls longer than this (dragging the window, a breakpoint) is dropped instead of simulated in a burst
+constexpr int MAX_CATCH_UP_TICKS = 8;
+
+GameClock::GameClock()
+{
+	frequency = SDL_GetPerformanceFrequency();
+	tickLength = frequency / TICK_RATE;
+	lastCounter = SDL_GetPerformanceCounter();
+}
+
+void GameClock::beginFrame()
+{
+	Uint64 now = SDL_GetPerformanceCounter();
+	accumulator += now - lastCounter;
+	lastCounter = now;
+
+	if (accumulator > tickLength * MAX_CATCH_UP_TICKS) {
+		accumulator = tickLength * MAX_CATCH_UP_TICKS;
+	}
+}
+
+bool GameClock::step()
+{
+	if (accumulator < tickLength) {
+		return false;
+	}
+
+	accumulator -= tickLength;
+	ticks++;
+	return true;
+}
+
+float GameClock::getAlpha() const
+{
+	return static_cast<float>(accumulator) / static_cast<float>(tickLength);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "SDL.h"
+
+// Fixed-timestep clock: the simulation always advances in 1/TICK_RATE second ticks no matter how fast frames render.
+// Every frame-counted timer in the game (stun, delays, shake, laser strikes) is really counting these ticks.
+class GameClock
+{
+public:
+	static constexpr int TICK_RATE = 60;
+
+	GameClock();
+
+	// Call once per rendered frame, adds the real time since the last call
+	void beginFrame();
+
+	// True while a whole tick is waiting to be simulated (consumes it)
+	bool step();
+
+	// How far between the last two ticks this frame is (0..1), for interpolating positions
+	float getAlpha() const;
+
+	Uint64 getTickCount() const { return ticks; }
+
+private:
+	Uint64 frequency;
+	Uint64 tickLength; // In performance counter units
+	Uint64 lastCounter;
+	Uint64 accumulator = 0;
+	Uint64 ticks = 0;
+};
@@ -0,0 +1,176 @@
+#include "GlyphAtlas.h"
+#include <algorithm>
+#include <iostream>
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer* ren, TTF_Font* font, bool blended) : renderer(ren)
+{
+	if (!font) {
+		SDL_Log("No font loaded...");
+		return;
+	}
+
+	lineHeight = TTF_FontHeight(font);
+
+	// Render every glyph in white, so the atlas can be tinted to any color when drawn
+	const SDL_Color white = { 255, 255, 255, 255 };
+	SDL_Surface* glyphSurfaces[LAST_GLYPH - FIRST_GLYPH + 1] = {};
+
+	// Shelf-pack the glyphs into rows
+	int penX = 0;
+	int penY = 0;
+	int rowHeight = 0;
+
+	for (int c = FIRST_GLYPH; c <= LAST_GLYPH; c++) {
+		Glyph& glyph = glyphs[c - FIRST_GLYPH];
+
+		int minX, maxX, minY, maxY;
+		if (TTF_GlyphMetrics(font, static_cast<Uint16>(c), &minX, &maxX, &minY, &maxY, &glyph.advance) != 0) {
+			continue;
+		}
+
+		SDL_Surface* surface = blended
+			? TTF_RenderGlyph_Blended(font, static_cast<Uint16>(c), white)
+			: TTF_RenderGlyph_Solid(font, static_cast<Uint16>(c), white);
+		if (!surface) {
+			continue;
+		}
+
+		if (penX + surface->w > ATLAS_WIDTH) {
+			penX = 0;
+			penY += rowHeight + 1;
+			rowHeight = 0;
+		}
+
+		glyph.src = { penX, penY, surface->w, surface->h };
+		glyphSurfaces[c - FIRST_GLYPH] = surface;
+
+		penX += surface->w + 1; // 1px gap so filtering never bleeds into a neighbour
+		rowHeight = std::max(rowHeight, surface->h);
+	}
+
+	atlasWidth = ATLAS_WIDTH;
+	atlasHeight = std::max(penY + rowHeight, 1);
+
+	SDL_Surface* atlasSurface = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+	if (atlasSurface) {
+		for (int i = 0; i <= LAST_GLYPH - FIRST_GLYPH; i++) {
+			if (glyphSurfaces[i]) {
+				// Copy alpha as-is rather than blending onto the (transparent) atlas
+				SDL_SetSurfaceBlendMode(glyphSurfaces[i], SDL_BLENDMODE_NONE);
+				SDL_BlitSurface(glyphSurfaces[i], nullptr, atlasSurface, &glyphs[i].src);
+			}
+		}
+
+		texture = SDL_CreateTextureFromSurface(renderer, atlasSurface);
+		SDL_FreeSurface(atlasSurface);
+	}
+
+	for (SDL_Surface* surface : glyphSurfaces) {
+		SDL_FreeSurface(surface);
+	}
+
+	if (texture) {
+		SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+	}
+	else {
+		std::cout << "Failed to build glyph atlas: " << SDL_GetError() << std::endl;
+	}
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+	SDL_DestroyTexture(texture);
+}
+
+const GlyphAtlas::Glyph& GlyphAtlas::glyphFor(char c) const
+{
+	int index = static_cast<unsigned char>(c);
+	if (index < FIRST_GLYPH || index > LAST_GLYPH) {
+		index = '?';
+	}
+	return glyphs[index - FIRST_GLYPH];
+}
+
+int GlyphAtlas::addText(const std::string& text, int x, int y, SDL_Color color)
+{
+	return addText(text.data(), text.size(), x, y, color);
+}
+
+int GlyphAtlas::addText(const char* text, size_t length, int x, int y, SDL_Color color)
+{
+	if (!texture) {
+		return x;
+	}
+
+	const float invWidth = 1.0f / atlasWidth;
+	const float invHeight = 1.0f / atlasHeight;
+
+	for (size_t i = 0; i < length; i++) {
+		const Glyph& glyph = glyphFor(text[i]);
+
+		if (glyph.src.w > 0 && glyph.src.h > 0) {
+			float left = static_cast<float>(x);
+			float top = static_cast<float>(y);
+			float right = left + glyph.src.w;
+			float bottom = top + glyph.src.h;
+
+			float u0 = glyph.src.x * invWidth;
+			float v0 = glyph.src.y * invHeight;
+			float u1 = (glyph.src.x + glyph.src.w) * invWidth;
+			float v1 = (glyph.src.y + glyph.src.h) * invHeight;
+
+			int base = static_cast<int>(vertices.size());
+			vertices.push_back({ { left, top }, color, { u0, v0 } });
+			vertices.push_back({ { right, top }, color, { u1, v0 } });
+			vertices.push_back({ { right, bottom }, color, { u1, v1 } });
+			vertices.push_back({ { left, bottom }, color, { u0, v1 } });
+
+			indices.push_back(base);
+			indices.push_back(base + 1);
+			indices.push_back(base + 2);
+			indices.push_back(base);
+			indices.push_back(base + 2);
+			indices.push_back(base + 3);
+		}
+
+		x += glyph.advance;
+	}
+
+	return x;
+}
+
+void GlyphAtlas::flush()
+{
+	if (!vertices.empty()) {
+		SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()),
+			indices.data(), static_cast<int>(indices.size()));
+	}
+
+	vertices.clear();
+	indices.clear();
+}
+
+void GlyphAtlas::draw(const std::string& text, int x, int y, SDL_Color color)
+{
+	addText(text, x, y, color);
+	flush();
+}
+
+int GlyphAtlas::measureWidth(const char* text, size_t length) const
+{
+	int width = 0;
+	for (size_t i = 0; i < length; i++) {
+		width += glyphFor(text[i]).advance;
+	}
+	return width;
+}
+
+void GlyphAtlas::measure(const std::string& text, int* width, int* height) const
+{
+	if (width) {
+		*width = measureWidth(text.data(), text.size());
+	}
+	if (height) {
+		*height = lineHeight;
+	}
+}
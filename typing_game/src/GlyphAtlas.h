@@ -0,0 +1,53 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "SDL.h"
+#include "SDL_ttf.h"
+
+// Every printable ASCII glyph of one font rasterized once into a single texture.
+// Strings are drawn as tinted quads from it (one SDL_RenderGeometry call per flush)
+// instead of rendering a surface and uploading a texture per string.
+class GlyphAtlas {
+public:
+	// blended = anti-aliased (TTF_RenderText_Blended look), otherwise hard-edged (TTF_RenderText_Solid look)
+	GlyphAtlas(SDL_Renderer* ren, TTF_Font* font, bool blended);
+	~GlyphAtlas();
+
+	GlyphAtlas(const GlyphAtlas&) = delete;
+	GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+	bool isValid() const { return texture != nullptr; }
+
+	// Queue text at (x, y), returns the x position after the last glyph
+	int addText(const std::string& text, int x, int y, SDL_Color color);
+	int addText(const char* text, size_t length, int x, int y, SDL_Color color);
+	void flush();
+
+	void draw(const std::string& text, int x, int y, SDL_Color color);
+	void measure(const std::string& text, int* width, int* height) const;
+	int measureWidth(const char* text, size_t length) const;
+	int getLineHeight() const { return lineHeight; }
+
+private:
+	static const int FIRST_GLYPH = 32; // ' '
+	static const int LAST_GLYPH = 126; // '~'
+	static const int ATLAS_WIDTH = 1024;
+
+	struct Glyph {
+		SDL_Rect src = { 0, 0, 0, 0 };
+		int advance = 0;
+	};
+
+	SDL_Renderer* renderer;
+	SDL_Texture* texture = nullptr;
+	int atlasWidth = 0;
+	int atlasHeight = 0;
+	int lineHeight = 0;
+	Glyph glyphs[LAST_GLYPH - FIRST_GLYPH + 1];
+
+	// Reused between flushes, so drawing doesn't allocate once they've grown
+	std::vector<SDL_Vertex> vertices;
+	std::vector<int> indices;
+
+	const Glyph& glyphFor(char c) const;
+};
@@ -0,0 +1,104 @@
+#include "InputManager.h"
+#include <algorithm>
+
+void InputManager::pollEvents() {
+	// Last frame's count is final now that nothing else can be deferred
+	peakEventsProcessed = std::max(peakEventsProcessed, eventsProcessed);
+
+	frameEvents.clear();
+
+	// Anything left over from last frame goes first so input order is kept
+	frameEvents.insert(frameEvents.end(), deferredEvents.begin(), deferredEvents.end());
+	deferredEvents.clear();
+
+	// Measure how far the queue has backed up before draining it
+	SDL_PumpEvents();
+	queueDepth = SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+	if (queueDepth < 0) {
+		queueDepth = 0;
+	}
+	peakQueueDepth = std::max(peakQueueDepth, queueDepth);
+
+	// Drain the whole queue, not just one event
+	SDL_Event e;
+	while (SDL_PollEvent(&e)) {
+		frameEvents.push_back(e);
+	}
+
+	eventsProcessed = static_cast<int>(frameEvents.size());
+}
+
+void InputManager::deferFrom(size_t index) {
+	if (index >= frameEvents.size()) return;
+
+	deferredEvents.assign(frameEvents.begin() + index, frameEvents.end());
+	eventsProcessed = static_cast<int>(index);
+}
+
+void InputManager::startKeystrokeCapture() {
+	if (capturingKeystrokes) return;
+
+	keystrokes.clear();
+	SDL_AddEventWatch(&InputManager::keystrokeWatch, this);
+	capturingKeystrokes = true;
+}
+
+void InputManager::stopKeystrokeCapture() {
+	if (!capturingKeystrokes) return;
+
+	SDL_DelEventWatch(&InputManager::keystrokeWatch, this);
+	capturingKeystrokes = false;
+}
+
+// Runs as soon as SDL receives an event (while events are being pumped), not when the frame gets to it
+int SDLCALL InputManager::keystrokeWatch(void* userdata, SDL_Event* event) {
+	InputManager* input = static_cast<InputManager*>(userdata);
+
+	if (event->type == SDL_TEXTINPUT) {
+		for (const char* c = event->text.text; *c != '\0'; ++c) {
+			Keystroke key;
+			key.type = Keystroke::CHARACTER;
+			key.character = *c;
+			key.timestamp = event->text.timestamp;
+
+			if (!input->keystrokes.push(key)) {
+				input->droppedKeystrokes++;
+			}
+		}
+	}
+	else if (event->type == SDL_KEYDOWN && event->key.keysym.sym == SDLK_BACKSPACE) {
+		Keystroke key;
+		key.type = Keystroke::BACKSPACE;
+		key.timestamp = event->key.timestamp;
+
+		if (!input->keystrokes.push(key)) {
+			input->droppedKeystrokes++;
+		}
+	}
+
+	return 1; // Watches can't drop events, the return value is ignored
+}
+
+bool InputManager::nextKeystroke(Keystroke& key) {
+	if (!keystrokes.pop(key)) return false;
+
+	// How long this key waited between arriving and being handled
+	Uint32 now = SDL_GetTicks();
+	Uint32 latency = now > key.timestamp ? now - key.timestamp : 0;
+
+	keystrokesHandled++;
+	totalKeystrokeLatency += latency;
+	peakKeystrokeLatency = std::max(peakKeystrokeLatency, latency);
+
+	return true;
+}
+
+void InputManager::discardKeystrokes() {
+	keystrokes.clear();
+}
+
+float InputManager::getAverageKeystrokeLatency() const {
+	return keystrokesHandled > 0
+		? static_cast<float>(totalKeystrokeLatency) / keystrokesHandled
+		: 0.0f;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "SDL.h"
+#include "KeystrokeBuffer.h"
+#include <vector>
+#include <algorithm>
+
+class InputManager {
+public:
+	// Drains every pending SDL event into this frame's input batch
+	void pollEvents();
+
+	// Events gathered for the current frame, in the order they arrived
+	const std::vector<SDL_Event>& getEvents() const { return frameEvents; }
+
+	// Hands the unprocessed tail of the batch (starting at index) over to the next frame
+	void deferFrom(size_t index);
+
+	// Starts/stops capturing typing keystrokes the moment SDL receives them
+	void startKeystrokeCapture();
+	void stopKeystrokeCapture();
+
+	// Pops the next buffered keystroke (false if none are waiting)
+	bool nextKeystroke(Keystroke& key);
+	void discardKeystrokes();
+
+	// Input stats
+	int getEventsProcessed() const { return eventsProcessed; }
+	int getPeakEventsProcessed() const { return std::max(peakEventsProcessed, eventsProcessed); }
+	int getQueueDepth() const { return queueDepth; }
+	int getPeakQueueDepth() const { return peakQueueDepth; }
+
+	// Keystroke latency stats (time from SDL receiving a key to the game handling it)
+	float getAverageKeystrokeLatency() const;
+	Uint32 getPeakKeystrokeLatency() const { return peakKeystrokeLatency; }
+	int getDroppedKeystrokes() const { return droppedKeystrokes.load(); }
+
+private:
+	static int SDLCALL keystrokeWatch(void* userdata, SDL_Event* event);
+
+	std::vector<SDL_Event> frameEvents;
+	std::vector<SDL_Event> deferredEvents;
+
+	int eventsProcessed = 0;     // Events handled this frame
+	int peakEventsProcessed = 0; // Most events handled in a single frame
+	int queueDepth = 0;          // Events waiting in SDL's queue at the start of this frame
+	int peakQueueDepth = 0;      // Deepest the SDL queue has been at the start of a frame
+
+	KeystrokeBuffer keystrokes;
+	bool capturingKeystrokes = false;
+	std::atomic<int> droppedKeystrokes{ 0 };
+
+	Uint64 keystrokesHandled = 0;
+	Uint64 totalKeystrokeLatency = 0;
+	Uint32 peakKeystrokeLatency = 0;
+};
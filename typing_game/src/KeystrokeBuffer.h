@@ -0,0 +1,83 @@
+#pragma once
+#include "SDL.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// A single typing keystroke, stamped with the time SDL received it (not the frame it was handled on)
+struct Keystroke
+{
+	enum Type : Uint8 { CHARACTER, BACKSPACE };
+
+	Type type = CHARACTER;
+	char character = '\0';
+	Uint32 timestamp = 0; // SDL event timestamp, in ms (same clock as SDL_GetTicks)
+};
+
+// Lock-free single-producer/single-consumer ring buffer of keystrokes.
+// The producer is the SDL event watch (fires while events are pumped), the consumer is Game::update.
+class KeystrokeBuffer
+{
+public:
+	static constexpr size_t capacity = 256; // Must be a power of two
+
+	// Producer side
+	bool push(const Keystroke& key)
+	{
+		size_t head = writeIndex.load(std::memory_order_relaxed);
+		size_t tail = readIndex.load(std::memory_order_acquire);
+
+		if (head - tail >= capacity) {
+			return false; // Full, keystroke dropped
+		}
+
+		slots[head & (capacity - 1)] = key;
+		writeIndex.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side
+	bool peek(Keystroke& key) const
+	{
+		size_t tail = readIndex.load(std::memory_order_relaxed);
+		size_t head = writeIndex.load(std::memory_order_acquire);
+
+		if (tail == head) {
+			return false; // Empty
+		}
+
+		key = slots[tail & (capacity - 1)];
+		return true;
+	}
+
+	void pop()
+	{
+		size_t tail = readIndex.load(std::memory_order_relaxed);
+		if (tail != writeIndex.load(std::memory_order_acquire)) {
+			readIndex.store(tail + 1, std::memory_order_release);
+		}
+	}
+
+	bool pop(Keystroke& key)
+	{
+		if (!peek(key)) return false;
+		pop();
+		return true;
+	}
+
+	// Consumer side: drops everything currently buffered
+	void clear()
+	{
+		readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+	size_t size() const
+	{
+		return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+	}
+
+private:
+	std::array<Keystroke, capacity> slots;
+	std::atomic<size_t> writeIndex{ 0 };
+	std::atomic<size_t> readIndex{ 0 };
+};
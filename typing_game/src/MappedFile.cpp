@@ -0,0 +1,105 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const char* path)
+{
+	close();
+
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		CloseHandle(file);
+		return false;
+	}
+
+	void* mapped = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!mapped) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	fileHandle = file;
+	mappingHandle = mapping;
+	view = static_cast<const char*>(mapped);
+	length = static_cast<size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (view) UnmapViewOfFile(view);
+	if (mappingHandle) CloseHandle(mappingHandle);
+	if (fileHandle) CloseHandle(fileHandle);
+
+	view = nullptr;
+	mappingHandle = nullptr;
+	fileHandle = nullptr;
+	length = 0;
+}
+
+#else
+
+bool MappedFile::open(const char* path)
+{
+	close();
+
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		::close(fd);
+		return false;
+	}
+
+	void* mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd); // The mapping keeps the file alive
+
+	if (mapped == MAP_FAILED) {
+		return false;
+	}
+
+	view = static_cast<const char*>(mapped);
+	length = static_cast<size_t>(info.st_size);
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (view) munmap(const_cast<char*>(view), length);
+
+	view = nullptr;
+	length = 0;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+
+// Read-only memory mapping of a whole file (MapViewOfFile on Windows, mmap elsewhere)
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool open(const char* path);
+	void close();
+
+	const char* data() const { return view; }
+	size_t size() const { return length; }
+	bool isOpen() const { return view != nullptr; }
+
+private:
+	const char* view = nullptr;
+	size_t length = 0;
+
+#ifdef _WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#endif
+};
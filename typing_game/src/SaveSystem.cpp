@@ -1,87 +1,318 @@
 #include "SaveSystem.h"
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <cstring>
+#include <filesystem>
 
-bool SaveSystem::saveToFile(const std::string& filename, const SaveData& data) {
-	std::ofstream outFile(filename);
-	if (!outFile.is_open()) {
-		std::cerr << "Failed to save game data!" << std::endl;
-		return false;
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#endif
+
+static const char SAVE_MAGIC[4] = { 'L', 'R', 'S', 'V' };
+constexpr size_t HEADER_SIZE = 16;
+
+// Standard CRC-32 (same as zip/PNG)
+static uint32_t crc32(const char* data, size_t size)
+{
+	static uint32_t table[256] = {};
+	if (table[1] == 0) {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t c = i;
+			for (int bit = 0; bit < 8; bit++) {
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			}
+			table[i] = c;
+		}
+	}
+
+	uint32_t crc = 0xFFFFFFFFu;
+	for (size_t i = 0; i < size; i++) {
+		crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF] ^ (crc >> 8);
+	}
+	return crc ^ 0xFFFFFFFFu;
+}
+
+// Fixed-size values are stored as their (little-endian) bytes
+template<typename T>
+static void put(std::vector<char>& out, T value)
+{
+	char bytes[sizeof(T)];
+	std::memcpy(bytes, &value, sizeof(T));
+	out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+// Reads values back in order, and remembers if it ever ran past the end
+struct SaveReader {
+	const char* data;
+	size_t size;
+	size_t offset = 0;
+	bool failed = false;
+
+	template<typename T>
+	T get() {
+		T value{};
+		if (offset + sizeof(T) > size) {
+			failed = true;
+			return value;
+		}
+		std::memcpy(&value, data + offset, sizeof(T));
+		offset += sizeof(T);
+		return value;
 	}
+};
+
+bool SaveSystem::saveToFile(const std::string& filename, const SaveData& data) {
+	std::vector<char> bytes;
+	bytes.reserve(HEADER_SIZE + 64 + data.lifetimeWrongCharacters.size() * 5 + data.lessonProgressMap.size() * 10);
+
+	// Header, size and checksum are filled in once the payload is written
+	bytes.insert(bytes.end(), SAVE_MAGIC, SAVE_MAGIC + 4);
+	put<uint32_t>(bytes, SAVE_VERSION);
+	put<uint32_t>(bytes, 0);
+	put<uint32_t>(bytes, 0);
 
-	outFile << data.lessonGamesPlayed << "\n";
-	outFile << data.lessonAccuracyTotal << "\n";
-	outFile << data.arcadeGamesPlayed << "\n";
-	outFile << data.arcadeAccuracyTotal << "\n";
-	outFile << data.arcadeHighestLevel << "\n";
-	outFile << data.wpmGamesPlayed << "\n";
-	outFile << data.wpmAccuracyTotal << "\n";
-	outFile << data.highestWpm << "\n";
+	put<int32_t>(bytes, data.lessonGamesPlayed);
+	put<float>(bytes, data.lessonAccuracyTotal);
+	put<int32_t>(bytes, data.arcadeGamesPlayed);
+	put<float>(bytes, data.arcadeAccuracyTotal);
+	put<int32_t>(bytes, data.arcadeHighestLevel);
+	put<int32_t>(bytes, data.wpmGamesPlayed);
+	put<float>(bytes, data.wpmAccuracyTotal);
+	put<int32_t>(bytes, data.highestWpm);
 
-	// Save lifetime wrong characters
-	outFile << data.lifetimeWrongCharacters.size() << "\n";
+	// Lifetime wrong characters
+	put<uint32_t>(bytes, static_cast<uint32_t>(data.lifetimeWrongCharacters.size()));
 	for (const auto& [ch, count] : data.lifetimeWrongCharacters) {
-		std::string encodedChar = (ch == ' ') ? "<space>" : std::string(1, ch);
-		outFile << encodedChar << " " << count << "\n";
+		put<char>(bytes, ch);
+		put<int32_t>(bytes, count);
 	}
 
-	// Save lesson progress
-	outFile << data.lessonProgressMap.size() << "\n";
+	// Lesson progress
+	put<uint32_t>(bytes, static_cast<uint32_t>(data.lessonProgressMap.size()));
 	for (const auto& [difficulty, progress] : data.lessonProgressMap) {
-		outFile << static_cast<int>(difficulty) << " "
-			<< progress.passed << " "
-			<< progress.fullyCompleted << " "
-			<< progress.bestAccuracy << " "
-			<< progress.bestTime << "\n";
+		put<uint8_t>(bytes, static_cast<uint8_t>(difficulty));
+		put<uint8_t>(bytes, (progress.passed ? 1 : 0) | (progress.fullyCompleted ? 2 : 0));
+		put<int32_t>(bytes, progress.bestAccuracy);
+		put<int32_t>(bytes, progress.bestTime);
 	}
 
-	outFile.close();
+	uint32_t payloadSize = static_cast<uint32_t>(bytes.size() - HEADER_SIZE);
+	uint32_t checksum = crc32(bytes.data() + HEADER_SIZE, payloadSize);
+	std::memcpy(bytes.data() + 8, &payloadSize, 4);
+	std::memcpy(bytes.data() + 12, &checksum, 4);
+
+	if (!writeFileAtomically(filename, bytes)) {
+		std::cerr << "Failed to save game data!" << std::endl;
+		return false;
+	}
 	return true;
 }
 
 bool SaveSystem::loadFromFile(const std::string& filename, SaveData& data) {
+	if (readSave(filename, data)) {
+		return true;
+	}
+
+	// A save that was fully written but not renamed yet (crash in between) is still good
+	if (readSave(filename + ".tmp", data)) {
+		std::cerr << "Recovered save data from " << filename << ".tmp" << std::endl;
+		return true;
+	}
+
+	return false;
+}
+
+bool SaveSystem::readSave(const std::string& filename, SaveData& data) {
+	std::ifstream inFile(filename, std::ios::binary);
+	if (!inFile.is_open()) {
+		return false;
+	}
+
+	std::vector<char> bytes((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+
+	SaveReader header{ bytes.data(), bytes.size() };
+	if (bytes.size() < HEADER_SIZE || std::memcmp(bytes.data(), SAVE_MAGIC, 4) != 0) {
+		std::cerr << filename << " isn't a save file!" << std::endl;
+		return false;
+	}
+	header.offset = 4;
+	uint32_t version = header.get<uint32_t>();
+	uint32_t payloadSize = header.get<uint32_t>();
+	uint32_t checksum = header.get<uint32_t>();
+
+	if (version != SAVE_VERSION) {
+		std::cerr << filename << " is save version " << version << ", expected " << SAVE_VERSION << std::endl;
+		return false;
+	}
+	if (payloadSize != bytes.size() - HEADER_SIZE || crc32(bytes.data() + HEADER_SIZE, payloadSize) != checksum) {
+		std::cerr << filename << " is damaged (size/checksum mismatch)" << std::endl;
+		return false;
+	}
+
+	// Parse into a copy, so a bad file can't leave data half-loaded
+	SaveData loaded;
+	SaveReader in{ bytes.data() + HEADER_SIZE, payloadSize };
+
+	loaded.lessonGamesPlayed = in.get<int32_t>();
+	loaded.lessonAccuracyTotal = in.get<float>();
+	loaded.arcadeGamesPlayed = in.get<int32_t>();
+	loaded.arcadeAccuracyTotal = in.get<float>();
+	loaded.arcadeHighestLevel = in.get<int32_t>();
+	loaded.wpmGamesPlayed = in.get<int32_t>();
+	loaded.wpmAccuracyTotal = in.get<float>();
+	loaded.highestWpm = in.get<int32_t>();
+
+	uint32_t wrongCount = in.get<uint32_t>();
+	for (uint32_t i = 0; i < wrongCount && !in.failed; ++i) {
+		char ch = in.get<char>();
+		int32_t count = in.get<int32_t>();
+		loaded.lifetimeWrongCharacters[ch] = count;
+	}
+
+	uint32_t lessonCount = in.get<uint32_t>();
+	for (uint32_t i = 0; i < lessonCount && !in.failed; ++i) {
+		uint8_t difficultyInt = in.get<uint8_t>();
+		uint8_t flags = in.get<uint8_t>();
+		int32_t accuracy = in.get<int32_t>();
+		int32_t time = in.get<int32_t>();
+		if (difficultyInt >= WordListManager::LIST_COUNT) {
+			in.failed = true;
+			break;
+		}
+
+		WordListManager::Difficulty difficulty = static_cast<WordListManager::Difficulty>(difficultyInt);
+		loaded.lessonProgressMap[difficulty] = { (flags & 1) != 0, (flags & 2) != 0, accuracy, time };
+	}
+
+	if (in.failed || in.offset != payloadSize) {
+		std::cerr << filename << " is damaged (bad layout)" << std::endl;
+		return false;
+	}
+
+	data = std::move(loaded);
+	return true;
+}
+
+// Write everything to filename.tmp, force it to disk, then swap it in with a single rename
+bool SaveSystem::writeFileAtomically(const std::string& filename, const std::vector<char>& bytes) {
+	std::string tempName = filename + ".tmp";
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(tempName.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	DWORD written = 0;
+	bool ok = WriteFile(file, bytes.data(), static_cast<DWORD>(bytes.size()), &written, nullptr) && written == bytes.size();
+	ok = FlushFileBuffers(file) && ok;
+	CloseHandle(file);
+
+	if (!ok || !MoveFileExA(tempName.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+		DeleteFileA(tempName.c_str());
+		return false;
+	}
+#else
+	int file = ::open(tempName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (file < 0) {
+		return false;
+	}
+
+	bool ok = ::write(file, bytes.data(), bytes.size()) == static_cast<ssize_t>(bytes.size());
+	ok = ::fsync(file) == 0 && ok;
+	::close(file);
+
+	if (!ok || std::rename(tempName.c_str(), filename.c_str()) != 0) {
+		std::remove(tempName.c_str());
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+bool SaveSystem::saveExists(const std::string& filename) {
+	std::error_code error;
+	return std::filesystem::exists(filename, error);
+}
+
+void SaveSystem::discardTemp(const std::string& filename) {
+	std::error_code error;
+	if (std::filesystem::remove(filename + ".tmp", error)) {
+		std::cerr << "Discarded unfinished " << filename << ".tmp" << std::endl;
+	}
+}
+
+std::string SaveSystem::moveAside(const std::string& filename) {
+	namespace fs = std::filesystem;
+	std::error_code error;
+
+	// Never onto an older damaged save either
+	std::string aside = filename + ".damaged";
+	for (int n = 2; fs::exists(aside, error) || fs::exists(aside + ".tmp", error); n++) {
+		aside = filename + ".damaged" + std::to_string(n);
+	}
+
+	for (const char* suffix : { "", ".tmp" }) {
+		if (fs::exists(filename + suffix, error)) {
+			fs::rename(filename + suffix, aside + suffix, error);
+			if (error) {
+				return std::string();
+			}
+		}
+	}
+
+	return aside;
+}
+
+// Same reads the text format always did, but every one is checked and nothing is kept unless all of it parses
+bool SaveSystem::loadLegacyTextFile(const std::string& filename, SaveData& data) {
 	std::ifstream inFile(filename);
 	if (!inFile.is_open()) {
-		std::cerr << "No save file found. Starting fresh (or make that... flesh)!" << std::endl;
 		return false;
 	}
 
-	inFile >> data.lessonGamesPlayed;
-	inFile >> data.lessonAccuracyTotal;
-	inFile >> data.arcadeGamesPlayed;
-	inFile >> data.arcadeAccuracyTotal;
-	inFile >> data.arcadeHighestLevel;
-	inFile >> data.wpmGamesPlayed;
-	inFile >> data.wpmAccuracyTotal;
-	inFile >> data.highestWpm;
+	SaveData loaded;
+	if (!(inFile >> loaded.lessonGamesPlayed >> loaded.lessonAccuracyTotal
+		>> loaded.arcadeGamesPlayed >> loaded.arcadeAccuracyTotal >> loaded.arcadeHighestLevel
+		>> loaded.wpmGamesPlayed >> loaded.wpmAccuracyTotal >> loaded.highestWpm)) {
+		return false;
+	}
 
 	// Load lifetime wrong characters
 	size_t wrongCount;
 	if (!(inFile >> wrongCount)) return false; // Safety measure for corrupt save
-	data.lifetimeWrongCharacters.clear();
 	for (size_t i = 0; i < wrongCount; ++i) {
 		std::string chStr;
 		int count;
 		if (!(inFile >> chStr >> count)) return false;
 
 		char ch = (chStr == "<space>") ? ' ' : chStr[0];
-		data.lifetimeWrongCharacters[ch] = count;
+		loaded.lifetimeWrongCharacters[ch] = count;
 	}
 
 	// Load lesson progress
 	size_t lessonCount;
-	inFile >> lessonCount;
-	data.lessonProgressMap.clear();
+	if (!(inFile >> lessonCount)) return false;
 	for (size_t i = 0; i < lessonCount; ++i) {
 		int difficultyInt;
 		bool passed, fullyCompleted;
 		int accuracy, time;
 
-		inFile >> difficultyInt >> passed >> fullyCompleted >> accuracy >> time;
+		if (!(inFile >> difficultyInt >> passed >> fullyCompleted >> accuracy >> time)) return false;
+		if (difficultyInt < 0 || difficultyInt >= WordListManager::LIST_COUNT) return false;
+
 		WordListManager::Difficulty difficulty = static_cast<WordListManager::Difficulty>(difficultyInt);
-		data.lessonProgressMap[difficulty] = { passed, fullyCompleted, accuracy, time };
+		loaded.lessonProgressMap[difficulty] = { passed, fullyCompleted, accuracy, time };
 	}
 
-	inFile.close();
+	data = std::move(loaded);
 	return true;
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include "WordListManager.h"
@@ -34,6 +36,30 @@ public:
 		std::unordered_map<char, int> lifetimeWrongCharacters;
 	};
 
+	// Binary save: "LRSV", version, payload size, CRC-32 of the payload, then the payload.
+	// Written to filename.tmp, flushed to disk and renamed over filename, so a crash leaves either the old save or the new one.
+	static constexpr uint32_t SAVE_VERSION = 1;
+
 	static bool saveToFile(const std::string& filename, const SaveData& data);
+
+	// Leaves data untouched unless the whole file checks out (falls back to a finished filename.tmp that never got renamed)
 	static bool loadFromFile(const std::string& filename, SaveData& data);
-};
\ No newline at end of file
+
+	// Old whitespace-separated autosave.txt, only read to migrate it
+	static bool loadLegacyTextFile(const std::string& filename, SaveData& data);
+
+	// Whether filename is on disk, readable or not. A filename.tmp on its own doesn't count: if loadFromFile
+	// couldn't use it, it's a save torn before it was ever renamed into place
+	static bool saveExists(const std::string& filename);
+
+	// Delete a leftover filename.tmp
+	static void discardTemp(const std::string& filename);
+
+	// Rename an unreadable save (and its .tmp) to the first free filename.damaged[N], so saving again can't overwrite it.
+	// Returns the new name, empty if it couldn't be moved
+	static std::string moveAside(const std::string& filename);
+
+private:
+	static bool readSave(const std::string& filename, SaveData& data);
+	static bool writeFileAtomically(const std::string& filename, const std::vector<char>& bytes);
+};
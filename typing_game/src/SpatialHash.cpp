@@ -0,0 +1,153 @@
+#include "SpatialHash.h"
+#include "Collision.h"
+#include <algorithm>
+
+SpatialHash::SpatialHash(int minX, int minY, int maxX, int maxY, int cellSize)
+	: minX(minX), minY(minY), cellSize(cellSize)
+{
+	columns = (maxX - minX + cellSize - 1) / cellSize;
+	rows = (maxY - minY + cellSize - 1) / cellSize;
+	cells.resize(columns * rows);
+}
+
+int SpatialHash::cellX(int x) const
+{
+	return std::clamp((x - minX) / cellSize, 0, columns - 1);
+}
+
+int SpatialHash::cellY(int y) const
+{
+	return std::clamp((y - minY) / cellSize, 0, rows - 1);
+}
+
+int SpatialHash::insert(Entity* entity, const SDL_Rect& rect)
+{
+	int proxy;
+	if (!freeProxies.empty()) {
+		proxy = freeProxies.back();
+		freeProxies.pop_back();
+	}
+	else {
+		proxy = static_cast<int>(proxies.size());
+		proxies.emplace_back();
+	}
+
+	Proxy& p = proxies[proxy];
+	p.entity = entity;
+	p.rect = rect;
+	link(proxy);
+
+	count++;
+	return proxy;
+}
+
+void SpatialHash::move(int proxy, const SDL_Rect& rect)
+{
+	Proxy& p = proxies[proxy];
+	p.rect = rect;
+
+	// Most frames a collider stays inside the same cells
+	if (cellX(rect.x) == p.x0 && cellY(rect.y) == p.y0 &&
+		cellX(rect.x + rect.w) == p.x1 && cellY(rect.y + rect.h) == p.y1) {
+		return;
+	}
+
+	unlink(proxy);
+	link(proxy);
+}
+
+void SpatialHash::remove(int proxy)
+{
+	unlink(proxy);
+	proxies[proxy].entity = nullptr;
+	freeProxies.push_back(proxy);
+	count--;
+}
+
+void SpatialHash::clear()
+{
+	for (std::vector<int>& cell : cells) {
+		cell.clear();
+	}
+	proxies.clear();
+	freeProxies.clear();
+	count = 0;
+}
+
+void SpatialHash::link(int proxy)
+{
+	Proxy& p = proxies[proxy];
+	p.x0 = cellX(p.rect.x);
+	p.y0 = cellY(p.rect.y);
+	p.x1 = cellX(p.rect.x + p.rect.w);
+	p.y1 = cellY(p.rect.y + p.rect.h);
+
+	for (int y = p.y0; y <= p.y1; y++) {
+		for (int x = p.x0; x <= p.x1; x++) {
+			cells[y * columns + x].push_back(proxy);
+		}
+	}
+}
+
+void SpatialHash::unlink(int proxy)
+{
+	Proxy& p = proxies[proxy];
+
+	for (int y = p.y0; y <= p.y1; y++) {
+		for (int x = p.x0; x <= p.x1; x++) {
+			std::vector<int>& cell = cells[y * columns + x];
+			auto it = std::find(cell.begin(), cell.end(), proxy);
+			if (it != cell.end()) {
+				*it = cell.back();
+				cell.pop_back();
+			}
+		}
+	}
+
+	p.x1 = p.x0 - 1; // Empty range
+}
+
+void SpatialHash::query(const SDL_Rect& area, std::vector<Entity*>& out)
+{
+	// Stamp proxies as they're reported so ones spanning several cells only come out once
+	queryStamp++;
+
+	int x0 = cellX(area.x), x1 = cellX(area.x + area.w);
+	int y0 = cellY(area.y), y1 = cellY(area.y + area.h);
+
+	for (int y = y0; y <= y1; y++) {
+		for (int x = x0; x <= x1; x++) {
+			for (int proxy : cells[y * columns + x]) {
+				Proxy& p = proxies[proxy];
+				if (p.lastQuery == queryStamp) continue;
+
+				p.lastQuery = queryStamp;
+				if (Collision::AABB(p.rect, area)) {
+					out.push_back(p.entity);
+				}
+			}
+		}
+	}
+}
+
+bool SpatialHash::anyWithin(float x, float y, float radius) const
+{
+	int x0 = cellX(static_cast<int>(x - radius)), x1 = cellX(static_cast<int>(x + radius));
+	int y0 = cellY(static_cast<int>(y - radius)), y1 = cellY(static_cast<int>(y + radius));
+	float radiusSq = radius * radius;
+
+	for (int cy = y0; cy <= y1; cy++) {
+		for (int cx = x0; cx <= x1; cx++) {
+			for (int proxy : cells[cy * columns + cx]) {
+				const Proxy& p = proxies[proxy];
+				float dx = p.rect.x - x;
+				float dy = p.rect.y - y;
+				if (dx * dx + dy * dy < radiusSq) {
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <vector>
+#include "SDL.h"
+
+class Entity;
+
+// Uniform grid over the playfield for collider queries.
+// Colliders register once and then only touch the grid when they cross into different cells.
+class SpatialHash
+{
+public:
+	// Bounds reach past the screen since zombies spawn off it, anything further out lands in the edge cells
+	SpatialHash(int minX = -256, int minY = -256, int maxX = 1856, int maxY = 1156, int cellSize = 128);
+
+	int insert(Entity* entity, const SDL_Rect& rect);
+	void move(int proxy, const SDL_Rect& rect);
+	void remove(int proxy);
+	void clear(); // Drop everything, keeping the cells' memory
+
+	// Entities whose rect overlaps area (same test as Collision::AABB), each reported once
+	void query(const SDL_Rect& area, std::vector<Entity*>& out);
+
+	// True if any rect's top-left corner is closer than radius to (x, y)
+	bool anyWithin(float x, float y, float radius) const;
+
+	int getCount() const { return count; }
+
+private:
+	struct Proxy {
+		Entity* entity = nullptr;
+		SDL_Rect rect{};
+		int x0 = 0, y0 = 0, x1 = -1, y1 = -1; // Cell range it's filed under
+		unsigned int lastQuery = 0;
+	};
+
+	int minX, minY;
+	int cellSize;
+	int columns, rows;
+
+	std::vector<std::vector<int>> cells;
+	std::vector<Proxy> proxies;
+	std::vector<int> freeProxies;
+	unsigned int queryStamp = 0;
+	int count = 0;
+
+	int cellX(int x) const;
+	int cellY(int y) const;
+	void link(int proxy);
+	void unlink(int proxy);
+};
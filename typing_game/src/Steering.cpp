@@ -0,0 +1,137 @@
+#include "Steering.h"
+#include <cmath>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define STEERING_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define STEERING_SSE
+#endif
+
+// Scalar version of one seek lane, also used for the lanes left over after the vector loop
+static void seekLane(SteeringBatch& batch, size_t i, float targetX, float targetY, float speed)
+{
+	float dx = targetX - batch.x[i];
+	float dy = targetY - batch.y[i];
+
+	float magnitude = std::sqrt(dx * dx + dy * dy);
+	if (magnitude > 0) {
+		dx /= magnitude;
+		dy /= magnitude;
+	}
+
+	batch.dirX[i] = dx;
+	batch.dirY[i] = dy;
+	batch.x[i] += dx * speed;
+	batch.y[i] += dy * speed;
+}
+
+void Steering::seek(SteeringBatch& batch, float targetX, float targetY, float speed)
+{
+	size_t count = batch.size();
+	batch.dirX.resize(count);
+	batch.dirY.resize(count);
+
+	float* x = batch.x.data();
+	float* y = batch.y.data();
+	float* dirX = batch.dirX.data();
+	float* dirY = batch.dirY.data();
+	size_t i = 0;
+
+#if defined(STEERING_AVX)
+	const __m256 tx = _mm256_set1_ps(targetX);
+	const __m256 ty = _mm256_set1_ps(targetY);
+	const __m256 step = _mm256_set1_ps(speed);
+	const __m256 zero = _mm256_setzero_ps();
+
+	for (; i + 8 <= count; i += 8) {
+		__m256 px = _mm256_loadu_ps(x + i);
+		__m256 py = _mm256_loadu_ps(y + i);
+		__m256 dx = _mm256_sub_ps(tx, px);
+		__m256 dy = _mm256_sub_ps(ty, py);
+
+		__m256 magnitude = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+		__m256 moving = _mm256_cmp_ps(magnitude, zero, _CMP_GT_OQ);
+
+		// Lanes already on the target would divide 0 by 0, the mask zeroes them instead
+		dx = _mm256_and_ps(moving, _mm256_div_ps(dx, magnitude));
+		dy = _mm256_and_ps(moving, _mm256_div_ps(dy, magnitude));
+
+		_mm256_storeu_ps(dirX + i, dx);
+		_mm256_storeu_ps(dirY + i, dy);
+		_mm256_storeu_ps(x + i, _mm256_add_ps(px, _mm256_mul_ps(dx, step)));
+		_mm256_storeu_ps(y + i, _mm256_add_ps(py, _mm256_mul_ps(dy, step)));
+	}
+#elif defined(STEERING_SSE)
+	const __m128 tx = _mm_set1_ps(targetX);
+	const __m128 ty = _mm_set1_ps(targetY);
+	const __m128 step = _mm_set1_ps(speed);
+	const __m128 zero = _mm_setzero_ps();
+
+	for (; i + 4 <= count; i += 4) {
+		__m128 px = _mm_loadu_ps(x + i);
+		__m128 py = _mm_loadu_ps(y + i);
+		__m128 dx = _mm_sub_ps(tx, px);
+		__m128 dy = _mm_sub_ps(ty, py);
+
+		__m128 magnitude = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+		__m128 moving = _mm_cmpgt_ps(magnitude, zero);
+
+		// Lanes already on the target would divide 0 by 0, the mask zeroes them instead
+		dx = _mm_and_ps(moving, _mm_div_ps(dx, magnitude));
+		dy = _mm_and_ps(moving, _mm_div_ps(dy, magnitude));
+
+		_mm_storeu_ps(dirX + i, dx);
+		_mm_storeu_ps(dirY + i, dy);
+		_mm_storeu_ps(x + i, _mm_add_ps(px, _mm_mul_ps(dx, step)));
+		_mm_storeu_ps(y + i, _mm_add_ps(py, _mm_mul_ps(dy, step)));
+	}
+#endif
+
+	for (; i < count; i++) {
+		seekLane(batch, i, targetX, targetY, speed);
+	}
+}
+
+void Steering::translate(SteeringBatch& batch, float offsetX, float offsetY)
+{
+	size_t count = batch.size();
+	float* x = batch.x.data();
+	float* y = batch.y.data();
+	size_t i = 0;
+
+#if defined(STEERING_AVX)
+	const __m256 ox = _mm256_set1_ps(offsetX);
+	const __m256 oy = _mm256_set1_ps(offsetY);
+
+	for (; i + 8 <= count; i += 8) {
+		_mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), ox));
+		_mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), oy));
+	}
+#elif defined(STEERING_SSE)
+	const __m128 ox = _mm_set1_ps(offsetX);
+	const __m128 oy = _mm_set1_ps(offsetY);
+
+	for (; i + 4 <= count; i += 4) {
+		_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), ox));
+		_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), oy));
+	}
+#endif
+
+	for (; i < count; i++) {
+		x[i] += offsetX;
+		y[i] += offsetY;
+	}
+}
+
+const char* Steering::getPath()
+{
+#if defined(STEERING_AVX)
+	return "AVX";
+#elif defined(STEERING_SSE)
+	return "SSE";
+#else
+	return "scalar";
+#endif
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+// Positions of a batch of movers, one array per coordinate so the kernels can do 4 or 8 at a time
+struct SteeringBatch
+{
+	std::vector<float> x, y;
+	std::vector<float> dirX, dirY; // Unit direction each lane moved in (filled by seek)
+
+	void clear() { x.clear(); y.clear(); }
+	void add(float px, float py) { x.push_back(px); y.push_back(py); }
+	size_t size() const { return x.size(); }
+};
+
+// Batch movement kernels, AVX or SSE when the build has them, plain loops otherwise
+class Steering
+{
+public:
+	// Move every lane speed pixels straight toward (targetX, targetY)
+	static void seek(SteeringBatch& batch, float targetX, float targetY, float speed);
+
+	// Move every lane by the same offset (bonus stage rows)
+	static void translate(SteeringBatch& batch, float offsetX, float offsetY);
+
+	// Which kernel this build uses, for logging
+	static const char* getPath();
+};
@@ -0,0 +1,142 @@
+#include "TargetSelector.h"
+
+void TargetSelector::reset(size_t count)
+{
+	heap.clear();
+	position.assign(count, -1);
+	keys.assign(count, Key());
+	targets.assign(count, Target());
+}
+
+void TargetSelector::setPolicy(TargetPolicy newPolicy)
+{
+	if (newPolicy == policy) {
+		return;
+	}
+	policy = newPolicy;
+
+	// Every key changes, so work them all out again and rebuild the heap bottom-up
+	for (int slot : heap) {
+		keys[slot] = score(targets[slot]);
+	}
+	for (int i = static_cast<int>(heap.size()) / 2 - 1; i >= 0; i--) {
+		siftDown(i);
+	}
+}
+
+TargetSelector::Key TargetSelector::score(const Target& target) const
+{
+	float dx, dy;
+
+	switch (policy) {
+	case TargetPolicy::MOST_DANGEROUS:
+		dx = barrierX - target.x;
+		dy = barrierY - target.y;
+		return { target.stunned ? 1 : 0, dx * dx + dy * dy };
+
+	case TargetPolicy::BARRIER_SIDE:
+		dx = playerX - target.x;
+		dy = playerY - target.y;
+		return { target.attacking ? 0 : 1, dx * dx + dy * dy };
+
+	case TargetPolicy::CLOSEST:
+	default:
+		dx = playerX - target.x;
+		dy = playerY - target.y;
+		return { 0, dx * dx + dy * dy };
+	}
+}
+
+void TargetSelector::update(size_t slot, float x, float y, bool attacking, bool stunned)
+{
+	if (slot >= position.size()) {
+		position.resize(slot + 1, -1);
+		keys.resize(slot + 1, Key());
+		targets.resize(slot + 1, Target());
+	}
+
+	targets[slot] = { x, y, attacking, stunned };
+	Key key = score(targets[slot]);
+
+	if (position[slot] < 0) {
+		keys[slot] = key;
+		position[slot] = static_cast<int>(heap.size());
+		heap.push_back(static_cast<int>(slot));
+		siftUp(position[slot]);
+		return;
+	}
+
+	Key oldKey = keys[slot];
+	keys[slot] = key;
+
+	if (key < oldKey) {
+		siftUp(position[slot]);
+	}
+	else if (oldKey < key) {
+		siftDown(position[slot]);
+	}
+}
+
+void TargetSelector::remove(size_t slot)
+{
+	if (!contains(slot)) {
+		return;
+	}
+
+	int i = position[slot];
+	int last = static_cast<int>(heap.size()) - 1;
+
+	swapNodes(i, last);
+	heap.pop_back();
+	position[slot] = -1;
+
+	// Whatever got moved into the hole may need to go either way
+	if (i < static_cast<int>(heap.size())) {
+		int moved = heap[i];
+		siftUp(i);
+		siftDown(position[moved]);
+	}
+}
+
+void TargetSelector::swapNodes(int a, int b)
+{
+	int slotA = heap[a];
+	int slotB = heap[b];
+	heap[a] = slotB;
+	heap[b] = slotA;
+	position[slotA] = b;
+	position[slotB] = a;
+}
+
+void TargetSelector::siftUp(int i)
+{
+	while (i > 0) {
+		int parent = (i - 1) / 2;
+		if (!(keys[heap[i]] < keys[heap[parent]])) {
+			break;
+		}
+
+		swapNodes(i, parent);
+		i = parent;
+	}
+}
+
+void TargetSelector::siftDown(int i)
+{
+	int size = static_cast<int>(heap.size());
+
+	while (true) {
+		int smallest = i;
+		int left = i * 2 + 1;
+		int right = left + 1;
+
+		if (left < size && keys[heap[left]] < keys[heap[smallest]]) smallest = left;
+		if (right < size && keys[heap[right]] < keys[heap[smallest]]) smallest = right;
+		if (smallest == i) {
+			break;
+		}
+
+		swapNodes(i, smallest);
+		i = smallest;
+	}
+}
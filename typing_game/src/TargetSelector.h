@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+
+// How the crosshair picks the next zombie
+enum class TargetPolicy {
+	CLOSEST,         // Nearest to the player
+	MOST_DANGEROUS,  // Nearest to the barrier (stunned ones count as far away)
+	BARRIER_SIDE     // Zombies already hitting the barrier first, then nearest to the player
+};
+
+// Keeps a wave's live zombies in an indexed min-heap ordered by the current policy.
+// Slots are zombie indices (same as their word in arcadeWords), keys are (group, squared distance) so a group the
+// policy ranks behind never loses precision on the distance.
+class TargetSelector
+{
+public:
+	// Re-ranks every zombie already in, O(n)
+	void setPolicy(TargetPolicy newPolicy);
+	TargetPolicy getPolicy() const { return policy; }
+
+	void setPlayer(float x, float y) { playerX = x; playerY = y; }
+	void setBarrier(float x, float y) { barrierX = x; barrierY = y; }
+
+	// Start a new wave with slots 0..count-1, all empty until update() is called for them
+	void reset(size_t count);
+
+	// Add or re-rank a zombie after it moves, O(log n)
+	void update(size_t slot, float x, float y, bool attacking, bool stunned);
+
+	// Take a defeated zombie out, O(log n)
+	void remove(size_t slot);
+
+	// Best target by the current policy, -1 if none are left
+	int next() const { return heap.empty() ? -1 : heap[0]; }
+
+	bool contains(size_t slot) const { return slot < position.size() && position[slot] >= 0; }
+
+private:
+	TargetPolicy policy = TargetPolicy::CLOSEST;
+	float playerX = 0.0f, playerY = 0.0f;
+	float barrierX = 0.0f, barrierY = 0.0f;
+
+	struct Key {
+		int group = 0;          // Lower groups always rank first (e.g. attacking zombies for BARRIER_SIDE)
+		float distanceSq = 0.0f;
+
+		bool operator<(const Key& other) const
+		{
+			return group != other.group ? group < other.group : distanceSq < other.distanceSq;
+		}
+	};
+
+	// What the key was worked out from, so a policy change can redo it
+	struct Target {
+		float x = 0.0f, y = 0.0f;
+		bool attacking = false, stunned = false;
+	};
+
+	std::vector<int> heap;         // Slots, smallest key first
+	std::vector<int> position;     // Slot -> index in heap, -1 if not in it
+	std::vector<Key> keys;         // Slot -> key
+	std::vector<Target> targets;   // Slot -> last update
+
+	Key score(const Target& target) const;
+	void swapNodes(int a, int b);
+	void siftUp(int i);
+	void siftDown(int i);
+};
@@ -1,15 +1,284 @@
 #include "TextureManager.h"
+#include <algorithm>
+
+TextureManager::TextureCache& TextureManager::cache()
+{
+	static TextureCache* textureCache = new TextureCache();
+	return *textureCache;
+}
+
+TextureManager::SpriteBatch& TextureManager::batch()
+{
+	static SpriteBatch* spriteBatch = new SpriteBatch();
+	return *spriteBatch;
+}
 
 SDL_Texture* TextureManager::LoadTexture(const char* texture)
 {
+	TextureCache& c = cache();
+
+	auto it = c.byPath.find(texture);
+	if (it != c.byPath.end()) {
+		it->second.refCount++;
+		c.hits++;
+		return it->second.texture;
+	}
+
 	SDL_Surface* tempSurface = IMG_Load(texture);
 	SDL_Texture* tex = SDL_CreateTextureFromSurface(Game::renderer, tempSurface);
 	SDL_FreeSurface(tempSurface);
 
+	if (!tex) {
+		std::cout << "Failed to load texture " << texture << ": " << SDL_GetError() << std::endl;
+		return nullptr;
+	}
+
+	CachedTexture& entry = c.byPath[texture];
+	entry.texture = tex;
+	entry.refCount = 1;
+	c.pathOf[tex] = texture;
+	c.loads++;
+
 	return tex;
 }
 
-void TextureManager::Draw(SDL_Texture* tex, SDL_Rect src, SDL_Rect dest)
+void TextureManager::Retain(SDL_Texture* tex)
+{
+	if (!tex) {
+		return;
+	}
+
+	TextureCache& c = cache();
+
+	auto pathIt = c.pathOf.find(tex);
+	if (pathIt != c.pathOf.end()) {
+		c.byPath[pathIt->second].refCount++;
+	}
+}
+
+void TextureManager::Release(SDL_Texture* tex)
+{
+	if (!tex) {
+		return;
+	}
+
+	TextureCache& c = cache();
+
+	// Textures that aren't in the cache (or were already cleared) aren't ours to destroy
+	auto pathIt = c.pathOf.find(tex);
+	if (pathIt == c.pathOf.end()) {
+		return;
+	}
+
+	auto it = c.byPath.find(pathIt->second);
+	if (--it->second.refCount <= 0 && !it->second.preloaded) {
+		destroyEntry(it);
+	}
+}
+
+void TextureManager::Preload(const char* fileName)
+{
+	SDL_Texture* tex = LoadTexture(fileName);
+	if (!tex) {
+		return;
+	}
+
+	// Keep it resident, but don't count the preload itself as a reference
+	CachedTexture& entry = cache().byPath[fileName];
+	entry.preloaded = true;
+	entry.refCount--;
+}
+
+void TextureManager::Evict(const char* fileName)
+{
+	TextureCache& c = cache();
+
+	auto it = c.byPath.find(fileName);
+	if (it == c.byPath.end()) {
+		return;
+	}
+
+	// Still in use, so just let the last Release destroy it
+	it->second.preloaded = false;
+	if (it->second.refCount <= 0) {
+		destroyEntry(it);
+	}
+}
+
+void TextureManager::EvictUnused()
+{
+	TextureCache& c = cache();
+
+	for (auto it = c.byPath.begin(); it != c.byPath.end();) {
+		if (it->second.refCount <= 0) {
+			SDL_DestroyTexture(it->second.texture);
+			c.pathOf.erase(it->second.texture);
+			it = c.byPath.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+}
+
+void TextureManager::Clear()
+{
+	TextureCache& c = cache();
+
+	for (auto& [path, entry] : c.byPath) {
+		SDL_DestroyTexture(entry.texture);
+	}
+	c.byPath.clear();
+	c.pathOf.clear();
+}
+
+void TextureManager::ReloadAll()
 {
+	TextureCache& c = cache();
+	c.replaced.clear();
+
+	// Create every new texture before destroying any old one, so no new pointer can reuse an old address
+	for (auto& [path, entry] : c.byPath) {
+		SDL_Surface* tempSurface = IMG_Load(path.c_str());
+		SDL_Texture* tex = SDL_CreateTextureFromSurface(Game::renderer, tempSurface);
+		SDL_FreeSurface(tempSurface);
+
+		if (!tex) {
+			std::cout << "Failed to reload texture " << path << ": " << SDL_GetError() << std::endl;
+			continue;
+		}
+
+		c.replaced[entry.texture] = tex;
+		entry.texture = tex;
+	}
+
+	c.pathOf.clear();
+	for (auto& [path, entry] : c.byPath) {
+		c.pathOf[entry.texture] = path;
+	}
+
+	for (auto& [oldTexture, newTexture] : c.replaced) {
+		SDL_DestroyTexture(oldTexture);
+	}
+}
+
+SDL_Texture* TextureManager::Reloaded(SDL_Texture* tex)
+{
+	TextureCache& c = cache();
+
+	auto it = c.replaced.find(tex);
+	return it != c.replaced.end() ? it->second : tex;
+}
+
+void TextureManager::destroyEntry(std::unordered_map<std::string, CachedTexture>::iterator it)
+{
+	TextureCache& c = cache();
+
+	SDL_DestroyTexture(it->second.texture);
+	c.pathOf.erase(it->second.texture);
+	c.byPath.erase(it);
+}
+
+int TextureManager::getCachedCount()
+{
+	return static_cast<int>(cache().byPath.size());
+}
+
+int TextureManager::getLoadCount()
+{
+	return cache().loads;
+}
+
+int TextureManager::getHitCount()
+{
+	return cache().hits;
+}
+
+void TextureManager::Draw(SDL_Texture* tex, SDL_Rect src, SDL_Rect dest, int layer)
+{
+	SpriteBatch& b = batch();
+
+	if (b.open && tex) {
+		b.sprites.push_back({ layer, tex, static_cast<int>(b.sprites.size()), src, dest });
+		return;
+	}
+
 	SDL_RenderCopy(Game::renderer, tex, &src, &dest);
-}
\ No newline at end of file
+}
+
+void TextureManager::BeginBatch()
+{
+	SpriteBatch& b = batch();
+	b.open = true;
+	b.sprites.clear();
+}
+
+void TextureManager::FlushBatch()
+{
+	SpriteBatch& b = batch();
+	b.open = false;
+	b.drawCalls = 0;
+
+	std::sort(b.sprites.begin(), b.sprites.end(), [](const BatchedSprite& a, const BatchedSprite& c) {
+		if (a.layer != c.layer) return a.layer < c.layer;
+		if (a.texture != c.texture) return a.texture < c.texture;
+		return a.order < c.order;
+	});
+
+	size_t runStart = 0;
+	while (runStart < b.sprites.size()) {
+		const BatchedSprite& first = b.sprites[runStart];
+
+		int texW = 0, texH = 0;
+		SDL_QueryTexture(first.texture, nullptr, nullptr, &texW, &texH);
+		float invW = texW > 0 ? 1.0f / texW : 0.0f;
+		float invH = texH > 0 ? 1.0f / texH : 0.0f;
+
+		b.vertices.clear();
+		b.indices.clear();
+
+		// One quad per sprite until the layer or texture changes
+		size_t i = runStart;
+		for (; i < b.sprites.size() && b.sprites[i].layer == first.layer && b.sprites[i].texture == first.texture; i++) {
+			const SDL_Rect& src = b.sprites[i].src;
+			const SDL_Rect& dest = b.sprites[i].dest;
+			const SDL_Color white = { 255, 255, 255, 255 };
+
+			float left = static_cast<float>(dest.x);
+			float top = static_cast<float>(dest.y);
+			float right = static_cast<float>(dest.x + dest.w);
+			float bottom = static_cast<float>(dest.y + dest.h);
+
+			float u0 = src.x * invW;
+			float v0 = src.y * invH;
+			float u1 = (src.x + src.w) * invW;
+			float v1 = (src.y + src.h) * invH;
+
+			int base = static_cast<int>(b.vertices.size());
+			b.vertices.push_back({ { left, top }, white, { u0, v0 } });
+			b.vertices.push_back({ { right, top }, white, { u1, v0 } });
+			b.vertices.push_back({ { right, bottom }, white, { u1, v1 } });
+			b.vertices.push_back({ { left, bottom }, white, { u0, v1 } });
+
+			b.indices.push_back(base);
+			b.indices.push_back(base + 1);
+			b.indices.push_back(base + 2);
+			b.indices.push_back(base);
+			b.indices.push_back(base + 2);
+			b.indices.push_back(base + 3);
+		}
+
+		SDL_RenderGeometry(Game::renderer, first.texture, b.vertices.data(), static_cast<int>(b.vertices.size()),
+			b.indices.data(), static_cast<int>(b.indices.size()));
+		b.drawCalls++;
+
+		runStart = i;
+	}
+
+	b.sprites.clear();
+}
+
+int TextureManager::getBatchDrawCalls()
+{
+	return batch().drawCalls;
+}
@@ -1,9 +1,73 @@
 #pragma once
 #include "Game.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
 
 class TextureManager {
 
 public:
+	// Returns the shared texture for a path, decoding/uploading it only the first time (caller must Release it)
 	static SDL_Texture* LoadTexture(const char* fileName);
-	static void Draw(SDL_Texture* text, SDL_Rect src, SDL_Rect dest);
-};
\ No newline at end of file
+	static void Retain(SDL_Texture* tex); // Extra reference to a texture that came from LoadTexture
+	static void Release(SDL_Texture* tex);
+
+	// Preloaded textures stay resident even when nothing references them, until evicted
+	static void Preload(const char* fileName);
+	static void Evict(const char* fileName);
+	static void EvictUnused();
+	static void Clear(); // Destroys everything, call before the renderer goes away
+
+	// After SDL_RENDER_DEVICE_RESET every texture is gone: upload each cached one again from its file.
+	// Holders then swap their pointers with Reloaded (old -> new, anything else comes back as is).
+	static void ReloadAll();
+	static SDL_Texture* Reloaded(SDL_Texture* tex);
+
+	// Draws right away, unless a batch is open, in which case it's queued until FlushBatch
+	static void Draw(SDL_Texture* text, SDL_Rect src, SDL_Rect dest, int layer = 0);
+
+	// Queued sprites are sorted by layer then texture, so each texture is drawn with one call per layer
+	static void BeginBatch();
+	static void FlushBatch();
+	static int getBatchDrawCalls(); // Geometry calls made by the last flush
+
+	static int getCachedCount();
+	static int getLoadCount();
+	static int getHitCount();
+
+private:
+	struct CachedTexture {
+		SDL_Texture* texture = nullptr;
+		int refCount = 0;
+		bool preloaded = false;
+	};
+
+	struct TextureCache {
+		std::unordered_map<std::string, CachedTexture> byPath;
+		std::unordered_map<SDL_Texture*, std::string> pathOf;
+		std::unordered_map<SDL_Texture*, SDL_Texture*> replaced; // From the last ReloadAll
+		int loads = 0;
+		int hits = 0;
+	};
+
+	struct BatchedSprite {
+		int layer;
+		SDL_Texture* texture;
+		int order; // Submission order, keeps overlap stable within a layer/texture
+		SDL_Rect src;
+		SDL_Rect dest;
+	};
+
+	struct SpriteBatch {
+		bool open = false;
+		std::vector<BatchedSprite> sprites;
+		std::vector<SDL_Vertex> vertices;
+		std::vector<int> indices;
+		int drawCalls = 0;
+	};
+
+	// Never freed, so sprites destroyed during static teardown can still release safely
+	static TextureCache& cache();
+	static SpriteBatch& batch();
+	static void destroyEntry(std::unordered_map<std::string, CachedTexture>::iterator it);
+};
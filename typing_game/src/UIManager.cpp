@@ -2,20 +2,110 @@
 
 UIManager::UIManager(SDL_Renderer* ren) : renderer(ren) {}
 
-// Draw text on screen
-void UIManager::drawText(const std::string& text, int x, int y, SDL_Color color, TTF_Font* font) {
+UIManager::~UIManager() {
+	clearTextCache();
+}
+
+// Get (or build on first use) the glyph atlas for a font
+GlyphAtlas* UIManager::getAtlas(TTF_Font* font, bool blended) {
+	if (!font) {
+		SDL_Log("No font loaded...");
+		return nullptr;
+	}
+
+	auto& atlases = blended ? blendedAtlases : solidAtlases;
+	std::unique_ptr<GlyphAtlas>& atlas = atlases[font];
+	if (!atlas) {
+		atlas = std::make_unique<GlyphAtlas>(renderer, font, blended);
+	}
+
+	return atlas->isValid() ? atlas.get() : nullptr;
+}
+
+void UIManager::clearAtlases() {
+	solidAtlases.clear();
+	blendedAtlases.clear();
+}
+
+// Get the rendered texture for a string, rendering it only if it isn't cached yet
+const UIManager::CachedText* UIManager::getCachedText(const std::string& text, SDL_Color color, TTF_Font* font) {
+	Uint32 packedColor = (color.r << 24) | (color.g << 16) | (color.b << 8) | color.a;
+
+	auto found = textLookup.find({ font, packedColor, text });
+	if (found != textLookup.end()) {
+		textCacheHits++;
+		textLru.splice(textLru.begin(), textLru, found->second); // Mark as most recently used
+		return &*found->second;
+	}
+
+	textCacheMisses++;
+
 	if (!font) {
 		SDL_Log("No font loaded...");
+		return nullptr;
 	}
 
 	SDL_Surface* surface = TTF_RenderText_Solid(font, text.c_str(), color);
+	if (!surface) {
+		return nullptr;
+	}
+
 	SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+	int w = surface->w;
+	int h = surface->h;
+	SDL_FreeSurface(surface);
 
-	SDL_Rect destRect = { x, y, surface->w, surface->h };
-	SDL_RenderCopy(renderer, texture, nullptr, &destRect);
+	if (!texture) {
+		return nullptr;
+	}
 
-	SDL_FreeSurface(surface);
-	SDL_DestroyTexture(texture);
+	textLru.push_front({ font, packedColor, text, texture, w, h, static_cast<size_t>(w) * h * 4 });
+	CachedText& entry = textLru.front();
+	textLookup[{ font, packedColor, entry.text }] = textLru.begin();
+	textCacheBytes += entry.bytes;
+
+	trimTextCache();
+	return &entry;
+}
+
+// Evict least recently used strings until back under budget (always keeping the newest)
+void UIManager::trimTextCache() {
+	while (textCacheBytes > textCacheBudget && textLru.size() > 1) {
+		CachedText& oldest = textLru.back();
+		textLookup.erase({ oldest.font, oldest.color, oldest.text });
+		textCacheBytes -= oldest.bytes;
+		SDL_DestroyTexture(oldest.texture);
+		textLru.pop_back();
+	}
+}
+
+void UIManager::setTextCacheBudget(size_t bytes) {
+	textCacheBudget = bytes;
+	trimTextCache();
+}
+
+void UIManager::clearTextCache() {
+	for (CachedText& entry : textLru) {
+		SDL_DestroyTexture(entry.texture);
+	}
+	textLookup.clear();
+	textLru.clear();
+	textCacheBytes = 0;
+}
+
+// Draw text on screen
+void UIManager::drawText(const std::string& text, int x, int y, SDL_Color color, TTF_Font* font) {
+	if (GlyphAtlas* atlas = getAtlas(font)) {
+		atlas->draw(text, x, y, color);
+	}
+}
+
+// Draw text that stays the same frame to frame (headers, prompts) from one cached texture
+void UIManager::drawCachedText(const std::string& text, int x, int y, SDL_Color color, TTF_Font* font) {
+	if (const CachedText* cached = getCachedText(text, color, font)) {
+		SDL_Rect destRect = { x, y, cached->w, cached->h };
+		SDL_RenderCopy(renderer, cached->texture, nullptr, &destRect);
+	}
 }
 
 // Draw rectangle
@@ -28,10 +118,23 @@ void UIManager::drawRectangle(int x, int y, int width, int height, SDL_Color col
 
 // Center text on the screen
 void UIManager::drawCenteredText(const std::string& text, int y, SDL_Color color, TTF_Font* font, int screenWidth) {
+	GlyphAtlas* atlas = getAtlas(font);
+	if (!atlas) {
+		return;
+	}
+
 	int textWidth, textHeight;
-	TTF_SizeText(font, text.c_str(), &textWidth, &textHeight);
+	atlas->measure(text, &textWidth, &textHeight);
 	int x = (screenWidth / 2) - (textWidth / 2);
-	drawText(text, x, y, color, font);
+	atlas->draw(text, x, y, color);
+}
+
+void UIManager::drawCachedCenteredText(const std::string& text, int y, SDL_Color color, TTF_Font* font, int screenWidth) {
+	if (const CachedText* cached = getCachedText(text, color, font)) {
+		int x = (screenWidth / 2) - (cached->w / 2);
+		SDL_Rect destRect = { x, y, cached->w, cached->h };
+		SDL_RenderCopy(renderer, cached->texture, nullptr, &destRect);
+	}
 }
 
 // Health bar
@@ -53,27 +156,15 @@ void UIManager::drawHealthbar(int x, int y, int width, int height, int currentHe
 	SDL_RenderFillRect(renderer, &fgRect);
 
 	// Render text to the left of the health bar
-	if (font) {
-		SDL_Surface* textSurface = TTF_RenderText_Solid(font, labelText.c_str(), textColor);
-		if (textSurface) {
-			SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-			if (textTexture) {
-				int textWidth = textSurface->w;
-				int textHeight = textSurface->h;
-
-				// Align text to the left of the health bar, vertically centered
-				SDL_Rect textRect = {
-					x - textWidth - 10,                  // 10px padding to the left
-					y + (height / 2) - (textHeight / 2), // Vertically centered with the bar
-					textWidth,
-					textHeight
-				};
-
-				SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-				SDL_DestroyTexture(textTexture);
-			}
-			SDL_FreeSurface(textSurface);
-		}
+	if (GlyphAtlas* atlas = getAtlas(font)) {
+		int textWidth, textHeight;
+		atlas->measure(labelText, &textWidth, &textHeight);
+
+		// Align text to the left of the health bar, vertically centered
+		atlas->draw(labelText,
+			x - textWidth - 10,                  // 10px padding to the left
+			y + (height / 2) - (textHeight / 2), // Vertically centered with the bar
+			textColor);
 	}
 }
 
@@ -134,52 +225,29 @@ void UIManager::drawStatusBar(int x, int y, int width, int height, const std::st
 	SDL_RenderFillRect(renderer, &fillRect);
 
 	// Render text to the left of the status bar
-	if (labelFont) {
-		SDL_Surface* textSurface = TTF_RenderText_Solid(labelFont, labelText.c_str(), textColor);
-		if (textSurface) {
-			SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-			if (textTexture) {
-				int textWidth = textSurface->w;
-				int textHeight = textSurface->h;
-
-				// Align text to the left of the health bar, vertically centered
-				SDL_Rect textRect = {
-					x - textWidth - 10,                  // 10px padding to the left
-					y + (height / 2) - (textHeight / 2), // Vertically centered with the bar
-					textWidth,
-					textHeight
-				};
-
-				SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-				SDL_DestroyTexture(textTexture);
-			}
-			SDL_FreeSurface(textSurface);
-		}
+	if (GlyphAtlas* atlas = getAtlas(labelFont)) {
+		int textWidth, textHeight;
+		atlas->measure(labelText, &textWidth, &textHeight);
+
+		// Align text to the left of the health bar, vertically centered
+		atlas->draw(labelText,
+			x - textWidth - 10,                  // 10px padding to the left
+			y + (height / 2) - (textHeight / 2), // Vertically centered with the bar
+			textColor);
 	}
 
 	// Render status text centered in the bar
-	if (statusFont && showStatusText) {
-		SDL_Surface* textSurface = TTF_RenderText_Blended(statusFont, statusText.c_str(), textColor);
-
-		if (textSurface) {
-			SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-			if (textTexture) {
-				int textWidth = textSurface->w;
-				int textHeight = textSurface->h;
-
-				int verticalOffset = 4;
-
-				SDL_Rect textRect = {
-					x + (width / 2) - (textWidth / 2),
-					y + (height / 2) - (textHeight / 2) + verticalOffset,
-					textWidth,
-					textHeight
-				};
-
-				SDL_RenderCopy(renderer, textTexture, nullptr, &textRect);
-				SDL_DestroyTexture(textTexture);
-			}
-			SDL_FreeSurface(textSurface);
+	if (showStatusText) {
+		if (GlyphAtlas* atlas = getAtlas(statusFont, true)) {
+			int textWidth, textHeight;
+			atlas->measure(statusText, &textWidth, &textHeight);
+
+			int verticalOffset = 4;
+
+			atlas->draw(statusText,
+				x + (width / 2) - (textWidth / 2),
+				y + (height / 2) - (textHeight / 2) + verticalOffset,
+				textColor);
 		}
 	}
 }
@@ -197,50 +265,26 @@ void UIManager::drawThreatLvl(int x, int y, int width, int height, int threatLvl
 	SDL_RenderFillRect(renderer, &bgRect);
 
 	// === Render the THREAT LEVEL digit in the center ===
-	if (digitFont) {
+	if (GlyphAtlas* atlas = getAtlas(digitFont, true)) {
 		std::string lvlStr = std::to_string(threatLvl);
-		SDL_Surface* lvlSurface = TTF_RenderText_Blended(digitFont, lvlStr.c_str(), textColor);
-		if (lvlSurface) {
-			SDL_Texture* lvlTexture = SDL_CreateTextureFromSurface(renderer, lvlSurface);
-			if (lvlTexture) {
-				int textW = lvlSurface->w;
-				int textH = lvlSurface->h;
-
-				SDL_Rect textRect = {
-					x + (width / 2) - (textW / 2),
-					y + (height / 2) - (textH / 2),
-					textW,
-					textH
-				};
-
-				SDL_RenderCopy(renderer, lvlTexture, nullptr, &textRect);
-				SDL_DestroyTexture(lvlTexture);
-			}
-			SDL_FreeSurface(lvlSurface);
-		}
+		int textW, textH;
+		atlas->measure(lvlStr, &textW, &textH);
+
+		atlas->draw(lvlStr,
+			x + (width / 2) - (textW / 2),
+			y + (height / 2) - (textH / 2),
+			textColor);
 	}
 
 	// === Render the label text BELOW the square ===
-	if (labelFont) {
-		SDL_Surface* labelSurface = TTF_RenderText_Blended(labelFont, labelText.c_str(), textColor);
-		if (labelSurface) {
-			SDL_Texture* labelTexture = SDL_CreateTextureFromSurface(renderer, labelSurface);
-			if (labelTexture) {
-				int labelW = labelSurface->w;
-				int labelH = labelSurface->h;
-
-				SDL_Rect labelRect = {
-					x + (width / 2) - (labelW / 2),
-					y + height + 6, // 6px padding below the square
-					labelW,
-					labelH
-				};
-
-				SDL_RenderCopy(renderer, labelTexture, nullptr, &labelRect);
-				SDL_DestroyTexture(labelTexture);
-			}
-			SDL_FreeSurface(labelSurface);
-		}
+	if (GlyphAtlas* atlas = getAtlas(labelFont, true)) {
+		int labelW, labelH;
+		atlas->measure(labelText, &labelW, &labelH);
+
+		atlas->draw(labelText,
+			x + (width / 2) - (labelW / 2),
+			y + height + 6, // 6px padding below the square
+			textColor);
 	}
 }
 
@@ -254,57 +298,39 @@ void UIManager::drawComboAlert(int x, int y, int width, int height, int comboLev
 	}
 
 	// === Render the label text on the left ===
-	if (labelFont) {
-		SDL_Surface* labelSurface = TTF_RenderText_Blended(labelFont, labelText.c_str(), textColor);
-		if (labelSurface) {
-			SDL_Texture* labelTexture = SDL_CreateTextureFromSurface(renderer, labelSurface);
-			if (labelTexture) {
-				int labelW = labelSurface->w;
-				int labelH = labelSurface->h;
-
-				SDL_Rect labelRect = {
-					x,
-					y + (height / 2) - (labelH / 2),
-					labelW,
-					labelH
-				};
-
-				SDL_RenderCopy(renderer, labelTexture, nullptr, &labelRect);
-				SDL_DestroyTexture(labelTexture);
-
-				// === Draw the rectangle next to the label ===
-				int rectX = labelRect.x + labelRect.w + 10; // 10px padding between label and box
-
-				SDL_Rect outlineRect = { rectX - 2, y - 2, width + 4, height + 4 };
-				SDL_SetRenderDrawColor(renderer, outlineColor.r, outlineColor.g, outlineColor.b, outlineColor.a);
-				SDL_RenderFillRect(renderer, &outlineRect);
-
-				SDL_Rect bgRect = { rectX, y, width, height };
-				SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-				SDL_RenderFillRect(renderer, &bgRect);
-
-				// === Render the statusText centered inside the box ===
-				SDL_Surface* statusSurface = TTF_RenderText_Blended(statusFont, statusText.c_str(), textColor);
-				if (statusSurface) {
-					SDL_Texture* statusTexture = SDL_CreateTextureFromSurface(renderer, statusSurface);
-					if (statusTexture) {
-						int statusW = statusSurface->w;
-						int statusH = statusSurface->h;
-
-						SDL_Rect statusRect = {
-							rectX + (width / 2) - (statusW / 2),
-							y + (height / 2) - (statusH / 2),
-							statusW,
-							statusH
-						};
-
-						SDL_RenderCopy(renderer, statusTexture, nullptr, &statusRect);
-						SDL_DestroyTexture(statusTexture);
-					}
-					SDL_FreeSurface(statusSurface);
-				}
-			}
-			SDL_FreeSurface(labelSurface);
+	if (GlyphAtlas* labelAtlas = getAtlas(labelFont, true)) {
+		int labelW, labelH;
+		labelAtlas->measure(labelText, &labelW, &labelH);
+
+		SDL_Rect labelRect = {
+			x,
+			y + (height / 2) - (labelH / 2),
+			labelW,
+			labelH
+		};
+
+		labelAtlas->draw(labelText, labelRect.x, labelRect.y, textColor);
+
+		// === Draw the rectangle next to the label ===
+		int rectX = labelRect.x + labelRect.w + 10; // 10px padding between label and box
+
+		SDL_Rect outlineRect = { rectX - 2, y - 2, width + 4, height + 4 };
+		SDL_SetRenderDrawColor(renderer, outlineColor.r, outlineColor.g, outlineColor.b, outlineColor.a);
+		SDL_RenderFillRect(renderer, &outlineRect);
+
+		SDL_Rect bgRect = { rectX, y, width, height };
+		SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, bgColor.a);
+		SDL_RenderFillRect(renderer, &bgRect);
+
+		// === Render the statusText centered inside the box ===
+		if (GlyphAtlas* statusAtlas = getAtlas(statusFont, true)) {
+			int statusW, statusH;
+			statusAtlas->measure(statusText, &statusW, &statusH);
+
+			statusAtlas->draw(statusText,
+				rectX + (width / 2) - (statusW / 2),
+				y + (height / 2) - (statusH / 2),
+				textColor);
 		}
 	}
 }
@@ -325,52 +351,30 @@ void UIManager::drawTimeElapsed(int x, int y, int width, int height, int elapsed
 	// Convert elapsed time to MM:SS
 	int minutes = elapsedSeconds / 60;
 	int seconds = elapsedSeconds % 60;
-	std::string timeStr = (minutes < 10 ? "0" : "") + std::to_string(minutes) + ":" +
-		(seconds < 10 ? "0" : "") + std::to_string(seconds);
+	char timeStr[16];
+	SDL_snprintf(timeStr, sizeof(timeStr), "%02d:%02d", minutes, seconds);
 
 	// Render time string centered
-	if (digitFont) {
-		SDL_Surface* timeSurface = TTF_RenderText_Blended(digitFont, timeStr.c_str(), textColor);
-		if (timeSurface) {
-			SDL_Texture* timeTexture = SDL_CreateTextureFromSurface(renderer, timeSurface);
-			if (timeTexture) {
-				int textW = timeSurface->w;
-				int textH = timeSurface->h;
-
-				SDL_Rect textRect = {
-					x + (width / 2) - (textW / 2),
-					y + (height / 2) - (textH / 2),
-					textW,
-					textH
-				};
-
-				SDL_RenderCopy(renderer, timeTexture, nullptr, &textRect);
-				SDL_DestroyTexture(timeTexture);
-			}
-			SDL_FreeSurface(timeSurface);
-		}
+	if (GlyphAtlas* atlas = getAtlas(digitFont, true)) {
+		size_t length = SDL_strlen(timeStr);
+		int textW = atlas->measureWidth(timeStr, length);
+		int textH = atlas->getLineHeight();
+
+		atlas->addText(timeStr, length,
+			x + (width / 2) - (textW / 2),
+			y + (height / 2) - (textH / 2),
+			textColor);
+		atlas->flush();
 	}
 
 	// Label below
-	if (labelFont) {
-		SDL_Surface* labelSurface = TTF_RenderText_Blended(labelFont, labelText.c_str(), textColor);
-		if (labelSurface) {
-			SDL_Texture* labelTexture = SDL_CreateTextureFromSurface(renderer, labelSurface);
-			if (labelTexture) {
-				int labelW = labelSurface->w;
-				int labelH = labelSurface->h;
-
-				SDL_Rect labelRect = {
-					x + (width / 2) - (labelW / 2),
-					y + height + 6,
-					labelW,
-					labelH
-				};
-
-				SDL_RenderCopy(renderer, labelTexture, nullptr, &labelRect);
-				SDL_DestroyTexture(labelTexture);
-			}
-			SDL_FreeSurface(labelSurface);
-		}
+	if (GlyphAtlas* atlas = getAtlas(labelFont, true)) {
+		int labelW, labelH;
+		atlas->measure(labelText, &labelW, &labelH);
+
+		atlas->draw(labelText,
+			x + (width / 2) - (labelW / 2),
+			y + height + 6,
+			textColor);
 	}
-}
\ No newline at end of file
+}
@@ -1,19 +1,79 @@
 #pragma once
 #include <string>
+#include <string_view>
+#include <list>
+#include <memory>
+#include <unordered_map>
 #include "SDL.h"
 #include "SDL_ttf.h"
+#include "GlyphAtlas.h"
 
 class UIManager {
 private:
 	SDL_Renderer* renderer;
 
+	// One atlas per font, built the first time that font is drawn
+	std::unordered_map<TTF_Font*, std::unique_ptr<GlyphAtlas>> solidAtlases;
+	std::unordered_map<TTF_Font*, std::unique_ptr<GlyphAtlas>> blendedAtlases;
+
+	// Whole-string textures for drawCachedText, most recently used at the front
+	struct CachedText {
+		TTF_Font* font;
+		Uint32 color;
+		std::string text;
+		SDL_Texture* texture;
+		int w, h;
+		size_t bytes;
+	};
+
+	// Views into the list's own strings, so lookups never copy the text
+	struct TextKey {
+		TTF_Font* font;
+		Uint32 color;
+		std::string_view text;
+		bool operator==(const TextKey& other) const { return font == other.font && color == other.color && text == other.text; }
+	};
+
+	struct TextKeyHash {
+		size_t operator()(const TextKey& key) const {
+			size_t h = std::hash<std::string_view>()(key.text);
+			h ^= std::hash<TTF_Font*>()(key.font) + 0x9e3779b9 + (h << 6) + (h >> 2);
+			h ^= std::hash<Uint32>()(key.color) + 0x9e3779b9 + (h << 6) + (h >> 2);
+			return h;
+		}
+	};
+
+	std::list<CachedText> textLru;
+	std::unordered_map<TextKey, std::list<CachedText>::iterator, TextKeyHash> textLookup;
+	size_t textCacheBytes = 0;
+	size_t textCacheBudget = 8 * 1024 * 1024; // 8 MB
+	int textCacheHits = 0;
+	int textCacheMisses = 0;
+
+	const CachedText* getCachedText(const std::string& text, SDL_Color color, TTF_Font* font);
+	void trimTextCache();
+
 public:
 	// Constructor
 	UIManager(SDL_Renderer* ren);
+	~UIManager();
+
+	GlyphAtlas* getAtlas(TTF_Font* font, bool blended = false);
+	void clearAtlases(); // Call before closing any font that's been drawn with
+
+	void setTextCacheBudget(size_t bytes);
+	void clearTextCache();
+	size_t getTextCacheBytes() const { return textCacheBytes; }
+	int getTextCacheHits() const { return textCacheHits; }
+	int getTextCacheMisses() const { return textCacheMisses; }
 
 	void drawText(const std::string& text, int x, int y, SDL_Color color, TTF_Font* font);
 	void drawRectangle(int x, int y, int width, int height, SDL_Color color);
 	void drawCenteredText(const std::string& text, int y, SDL_Color color, TTF_Font* font, int screenWidth);
+
+	// Same as above, but kept as one texture in the LRU, only for text that's identical frame to frame (headers, prompts, records)
+	void drawCachedText(const std::string& text, int x, int y, SDL_Color color, TTF_Font* font);
+	void drawCachedCenteredText(const std::string& text, int y, SDL_Color color, TTF_Font* font, int screenWidth);
 	void drawHealthbar(int x, int y, int width, int height, int currentHealth, int maxHealth, const std::string& labelText, SDL_Color outlineColor, SDL_Color fgColor, SDL_Color bgColor, TTF_Font* font, SDL_Color textColor);
 	void drawStatusBar(int x, int y, int width, int height, const std::string& labelText, const std::string& statusText, SDL_Color outlineColor, SDL_Color bgColor, TTF_Font* labelFont, TTF_Font* statusFont, SDL_Color textColor);
 	void drawThreatLvl(int x, int y, int width, int height, int threatLvl, const std::string& labelText, SDL_Color outlineColor, SDL_Color bgColor, TTF_Font* labelFont, TTF_Font* digitFont, SDL_Color textColor);
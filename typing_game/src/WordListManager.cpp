@@ -2,76 +2,244 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
-#include <random>
-
-WordListManager::WordListManager() {
-	loadFromFile("wordlists/lesson_0.txt", LESSON_0);
-	loadFromFile("wordlists/lesson_1.txt", LESSON_1);
-	loadFromFile("wordlists/lesson_2.txt", LESSON_2);
-	loadFromFile("wordlists/lesson_3.txt", LESSON_3);
-	loadFromFile("wordlists/lesson_4.txt", LESSON_4);
-	loadFromFile("wordlists/lesson_5.txt", LESSON_5);
-	loadFromFile("wordlists/lesson_6.txt", LESSON_6);
-	loadFromFile("wordlists/lesson_7.txt", LESSON_7);
-	loadFromFile("wordlists/lesson_8.txt", LESSON_8);
-	loadFromFile("wordlists/lesson_9.txt", LESSON_9);
-
-	loadFromFile("wordlists/wpm.txt", WPM);
-	loadFromFile("wordlists/easy.txt", EASY);
-	loadFromFile("wordlists/medium.txt", MEDIUM);
-	loadFromFile("wordlists/hard.txt", HARD);
-	loadFromFile("wordlists/bonusLeft.txt", BONUSLEFT);
-	loadFromFile("wordlists/bonusRight.txt", BONUSRIGHT);
+#include <filesystem>
+#include <cstring>
+
+// Packed corpus layout (all integers little-endian uint32):
+//   "LRWC", version, list count
+//   per list: first word, word count
+//   total words, then total words + 1 offsets into the text
+//   text: every word back to back, no separators
+static const char CORPUS_MAGIC[4] = { 'L', 'R', 'W', 'C' };
+constexpr uint32_t CORPUS_VERSION = 1;
+
+// Source for each list, in Difficulty order
+static const char* const sourceFiles[WordListManager::LIST_COUNT] = {
+	"wordlists/lesson_0.txt",
+	"wordlists/lesson_1.txt",
+	"wordlists/lesson_2.txt",
+	"wordlists/lesson_3.txt",
+	"wordlists/lesson_4.txt",
+	"wordlists/lesson_5.txt",
+	"wordlists/lesson_6.txt",
+	"wordlists/lesson_7.txt",
+	"wordlists/lesson_8.txt",
+	"wordlists/lesson_9.txt",
+	"wordlists/wpm.txt",
+	"wordlists/easy.txt",
+	"wordlists/medium.txt",
+	"wordlists/hard.txt",
+	"wordlists/bonusLeft.txt",
+	"wordlists/bonusRight.txt"
+};
+
+static void appendU32(std::vector<char>& out, uint32_t value)
+{
+	char bytes[4];
+	std::memcpy(bytes, &value, 4);
+	out.insert(out.end(), bytes, bytes + 4);
 }
 
-// Load words from text file
-void WordListManager::loadFromFile(const std::string& filename, Difficulty difficulty) {
-	std::ifstream file(filename);
-	if (!file.is_open()) {
-		std::cerr << "Error! Could not open file: " << filename << std::endl;
-		return;
+static uint32_t readU32(const char* data, size_t offset)
+{
+	uint32_t value;
+	std::memcpy(&value, data + offset, 4);
+	return value;
+}
+
+// The corpus needs rebuilding if it's missing or any source list has changed since it was written
+static bool corpusIsStale(const char* corpusPath)
+{
+	namespace fs = std::filesystem;
+	std::error_code error;
+
+	auto corpusTime = fs::last_write_time(corpusPath, error);
+	if (error) {
+		return true;
 	}
 
-	std::string word;
-	while (std::getline(file, word)) {
-		if (!word.empty()) {
-			wordLists[difficulty].push_back(word);
+	for (const char* source : sourceFiles) {
+		auto sourceTime = fs::last_write_time(source, error);
+		if (!error && sourceTime > corpusTime) {
+			return true;
 		}
 	}
 
+	return false;
+}
+
+bool WordListManager::load(const char* corpusPath) {
+	mapped.close();
+	image.clear();
+
+	if (corpusIsStale(corpusPath)) {
+		return rebuild(corpusPath);
+	}
+
+	if (mapped.open(corpusPath) && attach(mapped.data(), mapped.size())) {
+		return true;
+	}
+
+	// Damaged or written by an older build (CORPUS_VERSION), so build it again like a stale one
+	std::cerr << "Word corpus is damaged or out of date, rebuilding: " << corpusPath << std::endl;
+	mapped.close(); // Has to let go of the file before it can be replaced
+	return rebuild(corpusPath);
+}
+
+// Build the corpus from the source lists, write it out next to them and map it (or keep it in memory if writing fails)
+bool WordListManager::rebuild(const char* corpusPath) {
+	std::vector<char> built;
+	if (!buildCorpus(built)) {
+		return false;
+	}
+
+	// Write it out next to the lists, so later runs just map it
+	std::string tempPath = std::string(corpusPath) + ".tmp";
+	std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+	bool written = file.write(built.data(), built.size()).good();
 	file.close();
+
+	std::error_code error;
+	if (written) {
+		std::filesystem::rename(tempPath, corpusPath, error);
+	}
+
+	if (!written || error) {
+		std::cerr << "Could not write " << corpusPath << ", keeping word lists in memory" << std::endl;
+		std::filesystem::remove(tempPath, error);
+		image = std::move(built);
+		return attach(image.data(), image.size());
+	}
+
+	std::cout << "Built word corpus: " << corpusPath << std::endl;
+
+	if (!mapped.open(corpusPath)) {
+		std::cerr << "Error! Could not open file: " << corpusPath << std::endl;
+		return false;
+	}
+
+	if (!attach(mapped.data(), mapped.size())) {
+		std::cerr << "Word corpus is damaged: " << corpusPath << std::endl;
+		mapped.close();
+		return false;
+	}
+
+	return true;
 }
 
-// Get multiple words from the list, in order
-std::vector<std::string> WordListManager::getWords(Difficulty difficulty, size_t numWords) const {
-	std::vector<std::string> selectedWords;
+// Point every list at its part of a corpus image, checking that it all fits first
+bool WordListManager::attach(const char* data, size_t size) {
+	for (WordList& list : lists) {
+		list = WordList();
+	}
 
-	const auto& words = wordLists.at(difficulty);
+	size_t headerSize = 12 + LIST_COUNT * 8 + 4;
+	if (size < headerSize || std::memcmp(data, CORPUS_MAGIC, 4) != 0 ||
+		readU32(data, 4) != CORPUS_VERSION || readU32(data, 8) != LIST_COUNT) {
+		return false;
+	}
 
-	if (words.empty()) return selectedWords; // return empty if no words are available
+	uint32_t totalWords = readU32(data, 12 + LIST_COUNT * 8);
+	size_t offsetsStart = headerSize;
+	size_t textStart = offsetsStart + (static_cast<size_t>(totalWords) + 1) * 4;
+	if (textStart > size) {
+		return false;
+	}
 
-	// Clamp to max available
-	numWords = std::min(numWords, words.size());
+	// Every word has to sit inside the text, so the offsets must never go backwards and the last one has to fit.
+	// One pass over the table at load, after that a lookup can't reach past the mapping whatever the file holds
+	const uint32_t* offsets = reinterpret_cast<const uint32_t*>(data + offsetsStart);
+	if (offsets[totalWords] > size - textStart) {
+		return false;
+	}
+	for (uint32_t i = 0; i < totalWords; i++) {
+		if (offsets[i] > offsets[i + 1]) {
+			return false;
+		}
+	}
 
-	selectedWords.insert(selectedWords.end(), words.begin(), words.begin() + numWords);
-	return selectedWords;
+	for (int i = 0; i < LIST_COUNT; i++) {
+		uint32_t firstWord = readU32(data, 12 + i * 8);
+		uint32_t wordCount = readU32(data, 16 + i * 8);
+		if (static_cast<size_t>(firstWord) + wordCount > totalWords) {
+			return false;
+		}
+
+		lists[i].text = data + textStart;
+		lists[i].offsets = offsets + firstWord;
+		lists[i].count = wordCount;
+	}
+
+	return true;
+}
+
+// Read every source list into one corpus image
+bool WordListManager::buildCorpus(std::vector<char>& out) {
+	std::vector<uint32_t> listFirst, listCount;
+	std::vector<uint32_t> offsets;
+	std::string text;
+
+	for (const char* source : sourceFiles) {
+		std::ifstream file(source);
+		if (!file.is_open()) {
+			std::cerr << "Error! Could not open file: " << source << std::endl;
+		}
+
+		listFirst.push_back(static_cast<uint32_t>(offsets.size()));
+
+		std::string word;
+		while (std::getline(file, word)) {
+			if (!word.empty() && word.back() == '\r') {
+				word.pop_back();
+			}
+			if (!word.empty()) {
+				offsets.push_back(static_cast<uint32_t>(text.size()));
+				text += word;
+			}
+		}
+
+		listCount.push_back(static_cast<uint32_t>(offsets.size()) - listFirst.back());
+	}
+
+	if (offsets.empty()) {
+		return false;
+	}
+
+	uint32_t totalWords = static_cast<uint32_t>(offsets.size());
+	offsets.push_back(static_cast<uint32_t>(text.size()));
+
+	out.clear();
+	out.reserve(12 + LIST_COUNT * 8 + 4 + offsets.size() * 4 + text.size());
+	out.insert(out.end(), CORPUS_MAGIC, CORPUS_MAGIC + 4);
+	appendU32(out, CORPUS_VERSION);
+	appendU32(out, LIST_COUNT);
+	for (int i = 0; i < LIST_COUNT; i++) {
+		appendU32(out, listFirst[i]);
+		appendU32(out, listCount[i]);
+	}
+	appendU32(out, totalWords);
+	for (uint32_t offset : offsets) {
+		appendU32(out, offset);
+	}
+	out.insert(out.end(), text.begin(), text.end());
+
+	return true;
 }
 
-// Get multiple words from the list, randomized
-std::vector<std::string> WordListManager::getRandomWords(Difficulty difficulty, size_t numWords) const {
+// Get multiple words from the list, in order
+std::vector<std::string> WordListManager::getWords(Difficulty difficulty, size_t numWords) const {
 	std::vector<std::string> selectedWords;
 
-	const auto& words = wordLists.at(difficulty);
+	const WordList& words = lists[difficulty];
 
 	if (words.empty()) return selectedWords; // return empty if no words are available
 
-	std::random_device rd;
-	std::mt19937 rng(rd());
-	std::uniform_int_distribution<size_t> dist(0, wordLists.at(difficulty).size() - 1);
+	// Clamp to max available
+	numWords = std::min(numWords, words.size());
 
+	selectedWords.reserve(numWords);
 	for (size_t i = 0; i < numWords; ++i) {
-		selectedWords.push_back(wordLists.at(difficulty)[dist(rng)]);
+		selectedWords.emplace_back(words[i]);
 	}
-
 	return selectedWords;
-}
\ No newline at end of file
+}
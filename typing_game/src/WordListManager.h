@@ -2,21 +2,41 @@
 
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <cstdint>
+#include "MappedFile.h"
+
+// One list inside the packed corpus, word i runs from offsets[i] to offsets[i + 1] in text
+struct WordList {
+	const char* text = nullptr;
+	const uint32_t* offsets = nullptr;
+	size_t count = 0;
+
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+	std::string_view operator[](size_t i) const { return std::string_view(text + offsets[i], offsets[i + 1] - offsets[i]); }
+};
 
 class WordListManager {
 public:
 	enum Difficulty { LESSON_0, LESSON_1, LESSON_2, LESSON_3, LESSON_4, LESSON_5, LESSON_6, LESSON_7, LESSON_8, LESSON_9, WPM, EASY, MEDIUM, HARD, BONUSLEFT, BONUSRIGHT };
+	static constexpr int LIST_COUNT = BONUSRIGHT + 1;
 
-	WordListManager();
+	// Map the packed corpus, (re)building it from the wordlists/*.txt files first if it's missing, older than them,
+	// damaged or from an older CORPUS_VERSION
+	bool load(const char* corpusPath = "wordlists/words.bin");
+
+	const WordList& getList(Difficulty difficulty) const { return lists[difficulty]; }
 
 	// Get words from text file based on difficulty
 	std::vector<std::string> getWords(Difficulty difficulty, size_t numWords) const;
-	std::vector<std::string> getRandomWords(Difficulty difficulty, size_t numWords) const;
 
 private:
-	std::unordered_map<Difficulty, std::vector<std::string>> wordLists;
-
-	void loadFromFile(const std::string& filename, Difficulty difficulty);
+	MappedFile mapped;
+	std::vector<char> image; // Corpus kept in memory instead, if it couldn't be written out and mapped
+	WordList lists[LIST_COUNT];
 
-};
\ No newline at end of file
+	bool attach(const char* data, size_t size);
+	bool rebuild(const char* corpusPath);
+	static bool buildCorpus(std::vector<char>& out);
+};
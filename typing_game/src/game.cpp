@@ -4,6 +4,10 @@
 #include "ECS/Components.h"
 #include "Vector2D.h"
 #include "Collision.h"
+#include "InputManager.h"
+#include "TargetSelector.h"
+#include "Steering.h"
+#include "ContentPrefetcher.h"
 #include <iostream>
 #include <iomanip>
 #include <string>
@@ -13,6 +17,7 @@
 #include <vector> // For word lists and zombie count
 #include <cstdlib> // For rand() and srand()
 #include <ctime>   // For time()
+#include <cctype>  // For tolower()
 
 // For switching game states (modes)
 GameState gameState;
@@ -20,14 +25,18 @@ GameState prevState;
 
 // Map / Managers
 Map* map;
+SpatialHash zombieGrid; // Before manager, so it outlives the colliders filed in it
 Manager manager;
 UIManager* uiManager;
 WordListManager wordManager;
+ContentPrefetcher prefetcher; // After wordManager, so its worker is stopped before the corpus goes away
+InputManager inputManager;
 WordListManager::Difficulty difficulty;
 
 // Renderer and Event structures
 SDL_Renderer* Game::renderer = nullptr;
 SDL_Event Game::event;
+float Game::renderAlpha = 1.0f;
 
 // Frame timer
 Uint32 currentTime;
@@ -45,7 +54,7 @@ Entity* barrier = nullptr;
 Entity* laserLeft = nullptr;
 Entity* laserRight = nullptr;
 Entity* comboMeter = nullptr;
-Entity* laserPowerup = nullptr;
+EntityHandle laserPowerup;
 Entity* exclamation = nullptr;
 
 // Shared Entities
@@ -65,26 +74,53 @@ TTF_Font* statusFont;
 TTF_Font* threatLvlFont;
 TTF_Font* comboStatusFont;
 TTF_Font* wpmFont;
+TTF_Font* promptFont;
 
 // Wordlists
 std::vector<std::string> lessonWords;
 std::vector<std::string> arcadeWords;
 std::vector<std::string> bonusLeft;
 std::vector<std::string> bonusRight;
+WavePlan wavePlan;   // Last wave/bonus plan taken from the prefetcher (keeps its buffers for the next swap)
+BonusPlan bonusPlan;
 
 // Holds current lesson difficulty
 WordListManager::Difficulty currentLessonDifficulty;
 
 // Arcade mode zombie entities and active zombie index
-std::vector<Entity*> zombies;
-std::vector<Entity*> leftToRight;
-std::vector<Entity*> rightToLeft;
-std::vector<Entity*> tombstones;
+std::vector<EntityHandle> zombies;
+std::vector<EntityHandle> leftToRight;
+std::vector<EntityHandle> rightToLeft;
+std::vector<EntityHandle> tombstones;
+
 size_t currentZombieIndex = 0; // Tracks the currently active zombie
 
 // Zombie logic booleans
 bool allZombiesTransformed = false;
 bool barrierUnderAttack = false; // Track if zombies are attacking
+std::vector<Entity*> nearbyZombies; // Scratch list for zombieGrid queries
+TargetSelector targetSelector; // Ranks live zombies for the crosshair
+SteeringBatch seekBatch; // Packed zombie positions for the movement kernels
+
+// The arcade loop gathers the seek batch and scatters it back in two passes over this, so both skip the same zombies
+using ArcadeZombieView = View<TransformComponent, TransformStatusComponent, SpriteComponent>;
+
+// The zombie currently being targeted in a group, or nullptr if the index is past the end or it was removed
+static Entity* currentZombie(const std::vector<EntityHandle>& group)
+{
+	return currentZombieIndex < group.size() ? group[currentZombieIndex].get() : nullptr;
+}
+
+// True once every zombie still around in a group has been defeated (removed ones count as defeated)
+static bool allTransformed(const std::vector<EntityHandle>& group)
+{
+	for (auto [zombie, transformStatus] : manager.view<TransformStatusComponent>(group)) {
+		if (!transformStatus.getTransformed()) {
+			return false;
+		}
+	}
+	return true;
+}
 
 Game::Game()
 {
@@ -108,6 +144,15 @@ void Game::init(const char* title, int width, int height, bool fullscreen)
 	if (SDL_Init(SDL_INIT_EVERYTHING) == 0)
 	{
 		std::cout << "Subsystems Intialized..." << std::endl;
+		std::cout << "Zombie movement using " << Steering::getPath() << " kernels" << std::endl;
+
+		// Map the word lists (built from wordlists/*.txt on first run or when they change)
+		if (!wordManager.load()) {
+			std::cout << "Word lists failed to load!" << std::endl;
+		}
+
+		// Start recording keystrokes (with their timestamps) as soon as SDL sees them
+		inputManager.startKeystrokeCapture();
 
 		window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, flags);
 		if (window)
@@ -142,6 +187,17 @@ void Game::init(const char* title, int width, int height, bool fullscreen)
 	uiManager = new UIManager(renderer);
 	map = new Map();
 
+	// Keep sprites that are spawned/swapped constantly resident, so gameplay never goes back to disk for them
+	TextureManager::Preload("assets/Zambie-Sheet.png");
+	TextureManager::Preload("assets/Zombie.png");
+	for (int i = 0; i <= 10; i++) {
+		TextureManager::Preload(("assets/Barrier_Orb_" + std::to_string(i) + ".png").c_str());
+	}
+	for (int i = 0; i <= 6; i++) {
+		TextureManager::Preload(("assets/Combo_Meter_" + std::to_string(i) + ".png").c_str());
+	}
+	fingerHints.load();
+
 	screenWidth = width;
 	screenHeight = height;
 
@@ -151,6 +207,12 @@ void Game::init(const char* title, int width, int height, bool fullscreen)
 
 	laserX = (screenWidth / 2) - ((68 * 2) / 2);
 
+	// Start preparing WPM lines and the first arcade wave/bonus stage in the background
+	prefetcher.start(&wordManager, playerX, 660, screenWidth);
+	updateWordWeakness();
+	prefetcher.requestWave(0);
+	prefetcher.requestBonus(1);
+
 	titleFont = TTF_OpenFont("assets/PressStart2P.ttf", 30);
 	menuFont = TTF_OpenFont("assets/PressStart2P.ttf", 20);
 	healthFont = TTF_OpenFont("assets/PressStart2P.ttf", 20);
@@ -161,17 +223,53 @@ void Game::init(const char* title, int width, int height, bool fullscreen)
 	threatLvlFont = TTF_OpenFont("assets/Technology-BoldItalic.TTF", 50);
 	comboStatusFont = TTF_OpenFont("assets/Technology-BoldItalic.TTF", 30);
 	wpmFont = TTF_OpenFont("assets/PressStart2P.ttf", 25);
+	promptFont = TTF_OpenFont("assets/PressStart2P.ttf", 16);
 }
 
 
 void Game::handleEvents()
 {
-	SDL_PollEvent(&event);
+	// Drain every pending event this frame (not just one), so fast typists don't back up the queue
+	inputManager.pollEvents();
+
+	const std::vector<SDL_Event>& batch = inputManager.getEvents();
+	for (size_t i = 0; i < batch.size(); ++i) {
+		GameState stateBefore = gameState;
+
+		event = batch[i];
+		handleEvent();
+
+		// A new screen needs update() to run before the next event lands, so hold the rest of the batch for next frame
+		if (gameState != stateBefore) {
+			inputManager.deferFrom(i + 1);
+			break;
+		}
+	}
+}
+
+// Handles a single event from this frame's input batch
+void Game::handleEvent()
+{
 	switch (event.type) {
 	case SDL_QUIT:
 		isRunning = false;
 		break;
 
+	case SDL_RENDER_TARGETS_RESET:
+		// Render target contents are gone, re-bake the map next time it's drawn
+		map->invalidate();
+		break;
+
+	case SDL_RENDER_DEVICE_RESET:
+		// Every texture was lost with the device: text rebuilds as it's next drawn, sprites and the map are re-uploaded now
+		uiManager->clearTextCache();
+		uiManager->clearAtlases();
+		TextureManager::ReloadAll();
+		manager.getPool<SpriteComponent>().forEach([](SpriteComponent& sprite) { sprite.reloadTexture(); });
+		fingerHints.reload();
+		map->resetDevice();
+		break;
+
 	case SDL_KEYDOWN:
 		switch (event.key.keysym.sym) {
 
@@ -320,6 +418,7 @@ void Game::handleEvents()
 				arcadeGamesPlayed++;
 				arcadeAccuracyTotal += arcadeSessionAccuracy;
 				saveProgress(); // Save progress after arcade game over
+				prefetcher.requestWave(0); // Next run's first wave, the one asked for was level + 1
 				gameState = GameState::MAIN_MENU;
 				std::cout << "Returning to main menu!" << std::endl;
 			}
@@ -428,161 +527,213 @@ void Game::handleEvents()
 				}
 			}
 			break;
-
-		case SDLK_BACKSPACE:
-			if (gameState == GameState::ARCADE_MODE || gameState == GameState::BONUS_STAGE) {
-				if (!userInput.empty()) {
-					userInput.pop_back(); // Remove last character
-				}
-			}
-			else if (gameState == GameState::WPM_TEST && !wpmUserInput.empty()) {
-				wpmUserInput.pop_back();
-			}
-			break;
 		}
 		break;
 
-	case SDL_TEXTINPUT:
-		if (gameState == GameState::LESSONS_MODE) {
-			char typedChar = event.text.text[0];
+	default:
+		break;
+	}
+}
 
-			// Prevent typing beyond target line
-			if (lessonUserInput.size() >= lessonCurrentLine.size()) {
-				return;
+// Applies one buffered keystroke to whichever typing mode is active
+void Game::handleKeystroke(const Keystroke& key)
+{
+	if (key.type == Keystroke::BACKSPACE) {
+		if (gameState == GameState::ARCADE_MODE || gameState == GameState::BONUS_STAGE) {
+			if (!userInput.empty()) {
+				userInput.pop_back(); // Remove last character
 			}
+		}
+		else if (gameState == GameState::WPM_TEST && !wpmUserInput.empty()) {
+			wpmUserInput.pop_back();
+		}
+		return;
+	}
 
-			// Add typed character
-			lessonUserInput += typedChar;
-			lessonTotalTypedChars++;
+	char typedChar = key.character;
 
-			// Determine correctness
-			isCorrect = (typedChar == lessonCurrentLine[lessonUserInput.size() - 1]);
-			if (isCorrect) {
-				lessonCorrectChars++;
-			}
-			else {
-				lessonIncorrectChars++;
-				typedWrong[typedChar]++;
-			}
-
-			// Cache texture (placing this here rather than in draw for frame stability)
-			std::string letter(1, typedChar);
-			SDL_Color color = isCorrect ? correct : wrong;
-			SDL_Surface* surface = TTF_RenderText_Solid(menuFont, letter.c_str(), color);
-			if (surface) {
-				SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-				if (texture) {
-					typedCharTextures.push_back(texture);
-					typedCharWidths.push_back(surface->w);
-					typedCharColors.push_back(color);
-				}
-				SDL_FreeSurface(surface);
-			}
+	if (gameState == GameState::LESSONS_MODE) {
+		// Prevent typing beyond target line
+		if (lessonUserInput.size() >= lessonCurrentLine.size()) {
+			return;
 		}
 
-		if (gameState == GameState::ARCADE_MODE) {
-			// Prevent spacebar from being typed as part of input
-			if (event.text.text[0] == ' ') {
-				break; // Skip input
-			}
+		// Add typed character
+		lessonUserInput += typedChar;
+		lessonTotalTypedChars++;
+
+		// Time the lesson by when the last key was actually pressed, not when the frame got to it
+		if (lessonUserInput.size() >= lessonCurrentLine.size()) {
+			lessonFinishTime = key.timestamp;
+		}
 
-			// Prevent typing if word is fully typed AND incorrect
-			if (userInput.size() >= targetText.size() && userInput != targetText) {
-				break; // Lock input until user hits backspace
+		// Determine correctness
+		isCorrect = (typedChar == lessonCurrentLine[lessonUserInput.size() - 1]);
+		if (isCorrect) {
+			lessonCorrectChars++;
+		}
+		else {
+			lessonIncorrectChars++;
+			typedWrong[typedChar]++;
+		}
+
+		// Cache texture (placing this here rather than in draw for frame stability)
+		std::string letter(1, typedChar);
+		SDL_Color color = isCorrect ? correct : wrong;
+		SDL_Surface* surface = TTF_RenderText_Solid(menuFont, letter.c_str(), color);
+		if (surface) {
+			SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+			if (texture) {
+				typedCharTextures.push_back(texture);
+				typedCharWidths.push_back(surface->w);
+				typedCharColors.push_back(color);
 			}
+			SDL_FreeSurface(surface);
+		}
+	}
 
-			userInput += event.text.text; // Append typed text
-			processedInput.assign(userInput.size(), false);
+	if (gameState == GameState::ARCADE_MODE) {
+		// Prevent spacebar from being typed as part of input
+		if (typedChar == ' ') {
+			return; // Skip input
+		}
 
-			if (userInput.back() != targetText[userInput.size() - 1]) {
-				brokenCombo = true;
-				comboStatus = "X";
-				comboLevel = 0;
+		// Prevent typing if word is fully typed AND incorrect
+		if (userInput.size() >= targetText.size() && userInput != targetText) {
+			return; // Lock input until user hits backspace
+		}
 
-				char wrongChar = targetText[userInput.size() - 1];
-				typedWrong[wrongChar]++; // Count every wrong keypress
-			}
+		userInput += typedChar; // Append typed character
+		processedInput.assign(userInput.size(), false);
 
-			// Increment total number of typed letters
-			levelTotalLetters++;
-			sessionTotalLetters++;
+		if (userInput.back() != targetText[userInput.size() - 1]) {
+			brokenCombo = true;
+			comboStatus = "X";
+			comboLevel = 0;
 
-			// Check if typed letter matches target letter
-			if (userInput.size() <= targetText.size() && event.text.text[0] == targetText[userInput.size() - 1]) {
-				levelCorrectLetters++; // Increment correct letters
-				sessionCorrectLetters++; // Increment total correct letters for game over screen
-			}
+			char wrongChar = targetText[userInput.size() - 1];
+			typedWrong[wrongChar]++; // Count every wrong keypress
 		}
 
-		if (gameState == GameState::BONUS_STAGE) {
-			// Prevent spacebar from being typed as part of input
-			if (event.text.text[0] == ' ') {
-				break; // Skip input
-			}
+		// Increment total number of typed letters
+		levelTotalLetters++;
+		sessionTotalLetters++;
 
-			// Prevent typing if word is fully typed AND incorrect
-			if (userInput.size() >= targetText.size() && userInput != targetText) {
-				break; // Lock input until user deletes
-			}
+		// Check if typed letter matches target letter
+		if (userInput.size() <= targetText.size() && typedChar == targetText[userInput.size() - 1]) {
+			levelCorrectLetters++; // Increment correct letters
+			sessionCorrectLetters++; // Increment total correct letters for game over screen
+		}
+	}
 
-			userInput += event.text.text; // Append typed text
-			processedInput.assign(userInput.size(), false);
+	if (gameState == GameState::BONUS_STAGE) {
+		// Prevent spacebar from being typed as part of input
+		if (typedChar == ' ') {
+			return; // Skip input
+		}
 
-			if (userInput.back() != targetText[userInput.size() - 1]) {
-				char wrongChar = targetText[userInput.size() - 1];
-				typedWrong[wrongChar]++; // Count every wrong keypress
-			}
+		// Prevent typing if word is fully typed AND incorrect
+		if (userInput.size() >= targetText.size() && userInput != targetText) {
+			return; // Lock input until user deletes
+		}
 
-			// Increment total number of typed letters
-			levelTotalLetters++;
-			sessionTotalLetters++;
+		userInput += typedChar; // Append typed character
+		processedInput.assign(userInput.size(), false);
 
-			// Check if typed letter matches target letter
-			if (userInput.size() <= targetText.size() && event.text.text[0] == targetText[userInput.size() - 1]) {
-				levelCorrectLetters++; // Increment correct letters
-				sessionCorrectLetters++; // Increment total correct letters for game over screen
-			}
+		if (userInput.back() != targetText[userInput.size() - 1]) {
+			char wrongChar = targetText[userInput.size() - 1];
+			typedWrong[wrongChar]++; // Count every wrong keypress
 		}
 
-		if (gameState == GameState::WPM_TEST) {
-			char typedChar = event.text.text[0];
+		// Increment total number of typed letters
+		levelTotalLetters++;
+		sessionTotalLetters++;
 
-			// Start timer on first keypress
-			if (!wpmTestStarted) {
-				wpmTestStarted = true;
-				lastSecondTick = SDL_GetTicks();
-			}
+		// Check if typed letter matches target letter
+		if (userInput.size() <= targetText.size() && typedChar == targetText[userInput.size() - 1]) {
+			levelCorrectLetters++; // Increment correct letters
+			sessionCorrectLetters++; // Increment total correct letters for game over screen
+		}
+	}
 
-			// Prevent typing beyond line length
-			if (wpmUserInput.size() >= wpmCurrentLine.size()) {
-				return; // Ignore extra input
-			}
+	if (gameState == GameState::WPM_TEST) {
+		// Start timer on first keypress
+		if (!wpmTestStarted) {
+			wpmTestStarted = true;
+			wpmStartTime = key.timestamp;
+		}
 
-			// Check correctness before appending char
-			size_t index = wpmUserInput.size();
-			if (typedChar == wpmCurrentLine[index]) {
-				wpmCorrectChars++;
-			}
-			else {
-				typedWrong[typedChar]++;
-			}
+		// Keys pressed after time ran out don't count, even if they're handled a frame later
+		if (key.timestamp - wpmStartTime >= WPM_TEST_DURATION) {
+			return;
+		}
 
-			// Add typed character
-			wpmUserInput += typedChar;
-			wpmTotalTypedChars++;
+		// Prevent typing beyond line length
+		if (wpmUserInput.size() >= wpmCurrentLine.size()) {
+			return; // Ignore extra input
 		}
-		break;
+
+		// Check correctness before appending char
+		size_t index = wpmUserInput.size();
+		if (typedChar == wpmCurrentLine[index]) {
+			wpmCorrectChars++;
+		}
+		else {
+			typedWrong[typedChar]++;
+		}
+
+		// Add typed character
+		wpmUserInput += typedChar;
+		wpmTotalTypedChars++;
+	}
+}
+
+// Applies everything typed since last frame, in the order (and with the timestamps) it was typed
+void Game::consumeKeystrokes()
+{
+	bool typingState = gameState == GameState::LESSONS_MODE || gameState == GameState::ARCADE_MODE ||
+		gameState == GameState::BONUS_STAGE || gameState == GameState::WPM_TEST;
+
+	// Keys pressed on menus/results screens shouldn't spill into the next typing mode
+	if (!typingState) {
+		inputManager.discardKeystrokes();
+		return;
+	}
+
+	// Stop at a finished prompt/line so the rest of update() handles it first, leftover keys carry over
+	Keystroke key;
+	while (!typingNeedsUpdate() && inputManager.nextKeystroke(key)) {
+		handleKeystroke(key);
+	}
+}
+
+// True when typed input has finished a prompt/line that update() hasn't processed yet
+bool Game::typingNeedsUpdate() const
+{
+	switch (gameState) {
+	case GameState::ARCADE_MODE:
+	case GameState::BONUS_STAGE:
+		return !targetText.empty() && userInput == targetText;
+
+	case GameState::WPM_TEST:
+		return wpmUserInput.size() >= wpmCurrentLine.size();
 
 	default:
-		break;
+		return false;
 	}
 }
 
 
 void Game::update() {
 	manager.refresh();
+
+	// Remember where everything starts this tick so render can blend toward where it ends up
+	manager.getPool<TransformComponent>().forEach([](TransformComponent& transform) { transform.savePrevious(); });
 	manager.update();
 
+	// Typing is applied here rather than in handleEvents, straight from the keystroke buffer
+	consumeKeystrokes();
+
 	auto& playerTransform = player.getComponent<TransformComponent>();
 
 	switch (gameState) {
@@ -695,7 +846,7 @@ void Game::update() {
 
 		// Handle zombie defeats (based on percentage, each count as 25%)
 		if (!zombie1Defeated) {
-			zombie1->getComponent<SpriteComponent>().Play("Attack Down");
+			zombie1->getComponent<SpriteComponent>().Play(ANIM_ATTACK_DOWN);
 			if (lessonTargetCompletion >= 25.0f) {
 				//
 				//
@@ -717,13 +868,13 @@ void Game::update() {
 				activeLasers.push_back(laser);
 
 				zombie1Defeated = true;
-				zombie1->getComponent<SpriteComponent>().Play("Defeat");
+				zombie1->getComponent<SpriteComponent>().Play(ANIM_DEFEAT);
 				crosshair->getComponent<TransformComponent>().position = zombie2->getComponent<TransformComponent>().position;
 				zombiesRemaining = 3;
 			}
 		}
 		if (!zombie2Defeated) {
-			zombie2->getComponent<SpriteComponent>().Play("Attack Down");
+			zombie2->getComponent<SpriteComponent>().Play(ANIM_ATTACK_DOWN);
 			if (lessonTargetCompletion >= 50.0f) {
 				// Basic laser animation for eliminating zombie
 				int cannonX = laserMiddle->getComponent<TransformComponent>().position.x + 68; // Center of cannon
@@ -742,13 +893,13 @@ void Game::update() {
 				activeLasers.push_back(laser);
 
 				zombie2Defeated = true;
-				zombie2->getComponent<SpriteComponent>().Play("Defeat");
+				zombie2->getComponent<SpriteComponent>().Play(ANIM_DEFEAT);
 				crosshair->getComponent<TransformComponent>().position = zombie3->getComponent<TransformComponent>().position;
 				zombiesRemaining = 2;
 			}
 		}
 		if (!zombie3Defeated) {
-			zombie3->getComponent<SpriteComponent>().Play("Attack Down");
+			zombie3->getComponent<SpriteComponent>().Play(ANIM_ATTACK_DOWN);
 			if (lessonTargetCompletion >= 75.0f) {
 				// Basic laser animation for eliminating zombie
 				int cannonX = laserMiddle->getComponent<TransformComponent>().position.x + 68; // Center of cannon
@@ -768,13 +919,13 @@ void Game::update() {
 
 				zombie3Defeated = true;
 				lessonPassed = true; // they've earned a pass!
-				zombie3->getComponent<SpriteComponent>().Play("Defeat");
+				zombie3->getComponent<SpriteComponent>().Play(ANIM_DEFEAT);
 				crosshair->getComponent<TransformComponent>().position = zombie4->getComponent<TransformComponent>().position;
 				zombiesRemaining = 1;
 			}
 		}
 		if (!zombie4Defeated) {
-			zombie4->getComponent<SpriteComponent>().Play("Attack Down");
+			zombie4->getComponent<SpriteComponent>().Play(ANIM_ATTACK_DOWN);
 			if (lessonTargetCompletion >= 100.0f) {
 				// Basic laser animation for eliminating zombie
 				int cannonX = laserMiddle->getComponent<TransformComponent>().position.x + 68; // Center of cannon
@@ -794,7 +945,7 @@ void Game::update() {
 
 				zombie4Defeated = true;
 				lessonFullyCompleted = true;
-				zombie4->getComponent<SpriteComponent>().Play("Defeat");
+				zombie4->getComponent<SpriteComponent>().Play(ANIM_DEFEAT);
 				zombiesRemaining = 0;
 			}
 		}
@@ -806,7 +957,8 @@ void Game::update() {
 
 				// Freeze time and store it for results
 				lessonTimeFrozen = true;
-				lessonResultTime = lessonTimeElapsed;
+				lessonResultTime = (lessonFinishTime - lessonStartTime) / 1000;
+				lessonTimeElapsed = lessonResultTime;
 			}
 
 			if (lessonsResultsDelayTimer > 0) {
@@ -934,8 +1086,7 @@ void Game::update() {
 
 
 		// Update crosshair position if zombies are present
-		if (!zombies.empty() && currentZombieIndex < zombies.size()) {
-			Entity* activeZombie = zombies[currentZombieIndex];
+		if (Entity* activeZombie = currentZombie(zombies)) {
 			auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 			// Update crosshair's position to zombie's position
@@ -949,75 +1100,77 @@ void Game::update() {
 		// To update barrier attack status
 		barrierUnderAttack = false;
 
-		// Iterate through all zombies
-		for (size_t i = 0; i < zombies.size(); ++i) {
-			Entity* zombie = zombies[i];
-			auto& zombieTransform = zombie->getComponent<TransformComponent>();
-			auto& transformStatus = zombie->getComponent<TransformStatusComponent>();
+		// Zombies touching the barrier, straight from the grid instead of testing every one
+		nearbyZombies.clear();
+		zombieGrid.query(barrier->getComponent<ColliderComponent>().collider, nearbyZombies);
 
+		// Step every zombie that can move toward the player in one batch
+		seekBatch.clear();
+		for (auto [zombie, zombieTransform, transformStatus, sprite] : ArcadeZombieView(zombies)) {
 			// Update stun status and timer
 			transformStatus.updateStun();
 
+			if (!transformStatus.getTransformed() && !transformStatus.isStunned()) {
+				seekBatch.add(zombieTransform.position.x, zombieTransform.position.y);
+			}
+		}
+		Steering::seek(seekBatch, playerTransform.position.x, playerTransform.position.y, speed);
+
+		// Iterate through all zombies (i is the zombie's slot in zombies, so it lines up with its word in arcadeWords)
+		for (size_t lane = 0; auto [i, zombie, zombieTransform, transformStatus, sprite] : ArcadeZombieView(zombies).indexed()) {
+			bool attacking = false;
+
 			// If stunned and not transformed, play stun animation (but still allow prompt to be typed)
 			if (transformStatus.isStunned() && !transformStatus.getTransformed()) {
-				zombie->getComponent<SpriteComponent>().Play("Stun");
+				sprite.Play(ANIM_STUN);
 			}
 
 			// Check if zombie is transformed
 			if (!transformStatus.getTransformed() && !transformStatus.isStunned()) {
-				// Move zombie toward the player if not stunned
-				float dx = playerTransform.position.x - zombieTransform.position.x;
-				float dy = playerTransform.position.y - zombieTransform.position.y;
-
-				float magnitude = sqrt(dx * dx + dy * dy);
-				if (magnitude > 0) {
-					dx /= magnitude;
-					dy /= magnitude;
-				}
+				// Move zombie toward the player if not stunned (already stepped in the batch, in the same order)
+				float dx = seekBatch.dirX[lane];
+				float dy = seekBatch.dirY[lane];
 
-				zombieTransform.position.x += dx * speed;
-				zombieTransform.position.y += dy * speed;
+				zombieTransform.position.x = seekBatch.x[lane];
+				zombieTransform.position.y = seekBatch.y[lane];
+				lane++;
 
 				// Directional animation
-				auto& sprite = zombie->getComponent<SpriteComponent>();
-
 				if (std::abs(dx) > std::abs(dy)) {
 					if (dx > 0) {
-						sprite.Play("Walk Right");
+						sprite.Play(ANIM_WALK_RIGHT);
 					}
 					else {
-						sprite.Play("Walk Left");
+						sprite.Play(ANIM_WALK_LEFT);
 					}
 				}
 				else {
 					if (dy > 0) {
-						sprite.Play("Walk Down");
+						sprite.Play(ANIM_WALK_DOWN);
 					}
 				}
 
 				// Check for wall collisions
-				if (Collision::AABB(zombie->getComponent<ColliderComponent>().collider,
-					barrier->getComponent<ColliderComponent>().collider)) {
+				if (std::find(nearbyZombies.begin(), nearbyZombies.end(), &zombie) != nearbyZombies.end()) {
 					zombieTransform.position.x -= dx * speed;
 					zombieTransform.position.y -= dy * speed;
 
 					// Wall collision is true
 					barrierUnderAttack = true; // Track if zombies are attacking
+					attacking = true;
 
 					// Attacking animation
-					auto& sprite = zombie->getComponent<SpriteComponent>();
-
 					if (std::abs(dx) > std::abs(dy)) {
 						if (dx > 0) {
-							sprite.Play("Attack Right");
+							sprite.Play(ANIM_ATTACK_RIGHT);
 						}
 						else {
-							sprite.Play("Attack Left");
+							sprite.Play(ANIM_ATTACK_LEFT);
 						}
 					}
 					else {
 						if (dy > 0) {
-							sprite.Play("Attack Down");
+							sprite.Play(ANIM_ATTACK_DOWN);
 						}
 					}
 
@@ -1026,6 +1179,11 @@ void Game::update() {
 				}
 			}
 
+			// Keep this zombie's targeting rank current now that it has moved
+			if (!transformStatus.getTransformed()) {
+				targetSelector.update(i, zombieTransform.position.x, zombieTransform.position.y, attacking, transformStatus.isStunned());
+			}
+
 			// Lower HP by 10 every second the zombies are attacking the barrier
 			if (barrierUnderAttack && currentTime - lastAttackTime >= 1000) {
 				barrierHP -= 10;
@@ -1054,8 +1212,8 @@ void Game::update() {
 				int cannonX = laserMiddle->getComponent<TransformComponent>().position.x + 68; // Center of cannon
 				int cannonY = laserMiddle->getComponent<TransformComponent>().position.y + 128; // Bottom of cannon
 
-				int zombieX = zombie->getComponent<TransformComponent>().position.x + 32;
-				int zombieY = zombie->getComponent<TransformComponent>().position.y + 32;
+				int zombieX = zombieTransform.position.x + 32;
+				int zombieY = zombieTransform.position.y + 32;
 
 				LaserStrike laser;
 				laser.startX = cannonX;
@@ -1067,12 +1225,12 @@ void Game::update() {
 				activeLasers.push_back(laser);
 
 				// Transform zombie and play defeat animation
-				auto& sprite = zombie->getComponent<SpriteComponent>();
-				sprite.Play("Defeat");
+				sprite.Play(ANIM_DEFEAT);
 
 				// Update transformation status and account for how many zombies are inactive
 				transformStatus.setTransformed(true);
-				tombstones.push_back(zombie);
+				tombstones.push_back(zombie.handle());
+				targetSelector.remove(i);
 
 				// Update zombie count (for threat level) / zombies defeated
 				zombieCount--;
@@ -1083,69 +1241,54 @@ void Game::update() {
 
 				// Move to next closest zombie
 				if (i == currentZombieIndex) {
-					// Find closest remaining zombie
-					float closestDistance = std::numeric_limits<float>::max();
-					size_t closestZombieIndex = currentZombieIndex;
-
-					for (size_t j = 0; j < zombies.size(); ++j) {
-						if (!zombies[j]->getComponent<TransformStatusComponent>().getTransformed()) {
-							auto& targetZombieTransform = zombies[j]->getComponent<TransformComponent>();
-							float dx = playerTransform.position.x - targetZombieTransform.position.x;
-							float dy = playerTransform.position.y - targetZombieTransform.position.y;
-							float distance = sqrt(dx * dx + dy * dy);
-
-							if (distance < closestDistance) {
-								closestDistance = distance;
-								closestZombieIndex = j;
-							}
-						}
+					// Update current zombie to the closest remaining one (stays put if none are left)
+					int nextTarget = targetSelector.next();
+					if (nextTarget >= 0) {
+						currentZombieIndex = nextTarget;
 					}
-
-					// Update current zombie to the closest one
-					currentZombieIndex = closestZombieIndex;
 					targetText = arcadeWords[currentZombieIndex];
 				}
 			}
 		}
 		// Check if all zombies are transformed
-		allZombiesTransformed = true; // Assume all are defeated
-		for (auto* zombie : zombies) {
-			if (!zombie->getComponent<TransformStatusComponent>().getTransformed()) {
-				allZombiesTransformed = false;
-				break;
-			}
-		}
+		allZombiesTransformed = allTransformed(zombies);
 
 		// Laser power-up logic
 		if (laserActive) {
-			auto& laserTransform = laserPowerup->getComponent<TransformComponent>();
-			auto& laserCollider = laserPowerup->getComponent<ColliderComponent>();
+			Entity* laser = laserPowerup.get();
+			if (!laser) {
+				laserActive = false; // Its entity is gone, nothing left to sweep
+			}
+			else {
+				auto& laserTransform = laser->getComponent<TransformComponent>();
+				auto& laserCollider = laser->getComponent<ColliderComponent>();
+
+				// Move laser down!
+				laserTransform.position.y += laserSpeed;
 
-			// Move laser down!
-			laserTransform.position.y += laserSpeed;
+				// Check collision with zombies (the grid only hands back the ones the laser overlaps)
+				nearbyZombies.clear();
+				zombieGrid.query(laserCollider.collider, nearbyZombies);
 
-			// Check collision with zombies
-			for (auto* zombie : zombies) {
-				if (!zombie->getComponent<TransformStatusComponent>().getTransformed()) {
-					if (Collision::AABB(zombie->getComponent<ColliderComponent>().collider, laserCollider.collider)) {
+				for (Entity* zombie : nearbyZombies) {
+					auto& status = zombie->getComponent<TransformStatusComponent>();
+					if (!status.getTransformed()) {
 
 						// Get zapped, zambie! (stuns the zombie, making it unable to move or attack for 5 seconds)
-						auto& status = zombie->getComponent<TransformStatusComponent>();
 						if (!status.isStunned()) {
-							auto& sprite = zombie->getComponent<SpriteComponent>();
-							sprite.Play("Stun");
+							zombie->getComponent<SpriteComponent>().Play(ANIM_STUN);
 
-							status.setStunned(true, 300); // 5 seconds at 60 FPS
+							status.setStunned(true, 300); // 5 seconds (GameClock runs 60 ticks a second)
 						}
 					}
 				}
-			}
 
-			// Remove laser power-up when it reaches bottom of screen
-			if (laserTransform.position.y > 700) {
-				laserPowerup->destroy();
-				laserPowerup = nullptr;
-				laserActive = false;
+				// Remove laser power-up when it reaches bottom of screen
+				if (laserTransform.position.y > 700) {
+					laser->destroy();
+					laserPowerup.reset();
+					laserActive = false;
+				}
 			}
 		}
 
@@ -1177,6 +1320,7 @@ void Game::update() {
 			int exclaimY = player.getComponent<TransformComponent>().position.y - 5; // Slightly above player
 			exclamation->addComponent<TransformComponent>(exclaimX, exclaimY, 17, 16, 2);
 			exclamation->addComponent<SpriteComponent>("assets/Exclamation.png");
+			exclamation->getComponent<SpriteComponent>().setLayer(LAYER_EFFECTS);
 		}
 
 		// If the delay timer is counting down
@@ -1250,8 +1394,7 @@ void Game::update() {
 
 
 		// Update crosshair position if zombies are present in the left group
-		if (!leftToRight.empty() && currentZombieIndex < leftToRight.size()) {
-			Entity* activeZombie = leftToRight[currentZombieIndex];
+		if (Entity* activeZombie = currentZombie(leftToRight)) {
 			auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 			// Update crosshair's position to zombie's position
@@ -1260,8 +1403,7 @@ void Game::update() {
 		}
 
 		// Update crosshair position if zombies are present in the right group
-		if (!rightToLeft.empty() && currentZombieIndex < rightToLeft.size()) {
-			Entity* activeZombie = rightToLeft[currentZombieIndex];
+		if (Entity* activeZombie = currentZombie(rightToLeft)) {
 			auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 			// Update crosshair's position to zombie's position
@@ -1273,17 +1415,16 @@ void Game::update() {
 		updateHandSprites(targetText, userInput);
 
 		// Check if all left-to-right zombies are transformed before moving right-to-left zombies
-		leftGroupDefeated = true;
-		for (auto* zombie : leftToRight) {
-			if (!zombie->getComponent<TransformStatusComponent>().getTransformed()) {
-				leftGroupDefeated = false;
-				break;
-			}
-		}
+		leftGroupDefeated = allTransformed(leftToRight);
+
+		// Move the walking left-to-right zombies
+		moveBonusRow(true);
 
 		// Iterate through left-to-right zombies
 		for (size_t i = 0; i < leftToRight.size(); ++i) {
-			Entity* zombie = leftToRight[i];
+			Entity* zombie = leftToRight[i].get();
+			if (!zombie) continue; // Removed already
+
 			auto& zombieTransform = zombie->getComponent<TransformComponent>();
 			auto& transformStatus = zombie->getComponent<TransformStatusComponent>();
 
@@ -1291,7 +1432,7 @@ void Game::update() {
 			if (zombieTransform.position.x > 1600 && !transformStatus.getTransformed()) {
 				// Transform zombie
 				transformStatus.setTransformed(true);
-				tombstones.push_back(zombie);
+				tombstones.push_back(zombie->handle());
 
 				// Update zombie count
 				zombieCount--;
@@ -1301,13 +1442,14 @@ void Game::update() {
 
 				// Move to the zombie to the left (next in the group)
 				if (i == currentZombieIndex) {
-					float currentX = leftToRight[currentZombieIndex]->getComponent<TransformComponent>().position.x;
+					float currentX = zombie->getComponent<TransformComponent>().position.x; // i is the current zombie
 					float nextX = -std::numeric_limits<float>::max();
 					int nextZombieIndex = -1;
 
 					for (size_t j = 0; j < leftToRight.size(); ++j) {
-						if (!leftToRight[j]->getComponent<TransformStatusComponent>().getTransformed()) {
-							float candidateX = leftToRight[j]->getComponent<TransformComponent>().position.x;
+						Entity* candidate = leftToRight[j].get();
+						if (candidate && !candidate->getComponent<TransformStatusComponent>().getTransformed()) {
+							float candidateX = candidate->getComponent<TransformComponent>().position.x;
 
 							// Looking for left of current zombie
 							if (candidateX < currentX && candidateX > nextX) {
@@ -1326,12 +1468,10 @@ void Game::update() {
 
 			}
 
-			// Check if zombie is transformed, then move if not
+			// Check if zombie is transformed, then animate if not (moved by moveBonusRow)
 			if (!transformStatus.getTransformed()) {
 				auto& sprite = zombie->getComponent<SpriteComponent>();
-				sprite.Play("Walk Right");
-
-				zombieTransform.position.x += bonusSpeed;
+				sprite.Play(ANIM_WALK_RIGHT);
 			}
 
 			// Check if zombie's prompt matches user input
@@ -1355,9 +1495,9 @@ void Game::update() {
 
 				// Transform zombie, play defeat animation
 				auto& sprite = zombie->getComponent<SpriteComponent>();
-				sprite.Play("Defeat");
+				sprite.Play(ANIM_DEFEAT);
 				transformStatus.setTransformed(true);
-				tombstones.push_back(zombie);
+				tombstones.push_back(zombie->handle());
 
 				// Update zombie count / zombies defeated
 				zombieCount--;
@@ -1374,13 +1514,14 @@ void Game::update() {
 
 				// Move to the zombie to the left
 				if (i == currentZombieIndex) {
-					float currentX = leftToRight[currentZombieIndex]->getComponent<TransformComponent>().position.x;
+					float currentX = zombie->getComponent<TransformComponent>().position.x; // i is the current zombie
 					float nextX = -std::numeric_limits<float>::max();
 					int nextZombieIndex = -1;
 
 					for (size_t j = 0; j < leftToRight.size(); ++j) {
-						if (!leftToRight[j]->getComponent<TransformStatusComponent>().getTransformed()) {
-							float candidateX = leftToRight[j]->getComponent<TransformComponent>().position.x;
+						Entity* candidate = leftToRight[j].get();
+						if (candidate && !candidate->getComponent<TransformStatusComponent>().getTransformed()) {
+							float candidateX = candidate->getComponent<TransformComponent>().position.x;
 
 							// Looking for left of current zombie
 							if (candidateX < currentX && candidateX > nextX) {
@@ -1402,8 +1543,12 @@ void Game::update() {
 		// Iterate through right-to-left zombies, only if left group is defeated
 		if (leftGroupDefeated) {
 			targetText = bonusRight[currentZombieIndex]; // Use words from the right group
+			moveBonusRow(false);
+
 			for (size_t i = 0; i < rightToLeft.size(); ++i) {
-				Entity* zombie = rightToLeft[i];
+				Entity* zombie = rightToLeft[i].get();
+				if (!zombie) continue; // Removed already
+
 				auto& zombieTransform = zombie->getComponent<TransformComponent>();
 				auto& transformStatus = zombie->getComponent<TransformStatusComponent>();
 
@@ -1411,7 +1556,7 @@ void Game::update() {
 				if (zombieTransform.position.x < -75 && !transformStatus.getTransformed()) {
 					// Transform zombie
 					transformStatus.setTransformed(true);
-					tombstones.push_back(zombie);
+					tombstones.push_back(zombie->handle());
 
 					// Update zombie count
 					zombieCount--;
@@ -1421,13 +1566,14 @@ void Game::update() {
 
 					// Move to the zombie to the right
 					if (i == currentZombieIndex) {
-						float currentX = rightToLeft[currentZombieIndex]->getComponent<TransformComponent>().position.x;
+						float currentX = zombie->getComponent<TransformComponent>().position.x; // i is the current zombie
 						float nextX = std::numeric_limits<float>::max();
 						int nextZombieIndex = -1;
 
 						for (size_t j = 0; j < rightToLeft.size(); ++j) {
-							if (!rightToLeft[j]->getComponent<TransformStatusComponent>().getTransformed()) {
-								float candidateX = rightToLeft[j]->getComponent<TransformComponent>().position.x;
+							Entity* candidate = rightToLeft[j].get();
+							if (candidate && !candidate->getComponent<TransformStatusComponent>().getTransformed()) {
+								float candidateX = candidate->getComponent<TransformComponent>().position.x;
 
 								// Looking for right of current zombie
 								if (candidateX > currentX && candidateX < nextX) {
@@ -1446,12 +1592,10 @@ void Game::update() {
 
 				}
 
-				// Check if zombie is transformed, then move if not
+				// Check if zombie is transformed, then animate if not (moved by moveBonusRow)
 				if (!transformStatus.getTransformed()) {
 					auto& sprite = zombie->getComponent<SpriteComponent>();
-					sprite.Play("Walk Left");
-
-					zombieTransform.position.x -= bonusSpeed;
+					sprite.Play(ANIM_WALK_LEFT);
 				}
 
 				// Check if zombie's prompt matches user input
@@ -1475,9 +1619,9 @@ void Game::update() {
 
 					// Transform zombie and play defeat animation
 					auto& sprite = zombie->getComponent<SpriteComponent>();
-					sprite.Play("Defeat");
+					sprite.Play(ANIM_DEFEAT);
 					transformStatus.setTransformed(true);
-					tombstones.push_back(zombie);
+					tombstones.push_back(zombie->handle());
 
 					// Update zombie count / zombies defeated
 					zombieCount--;
@@ -1494,13 +1638,14 @@ void Game::update() {
 
 					// Move to the zombie to the right
 					if (i == currentZombieIndex) {
-						float currentX = rightToLeft[currentZombieIndex]->getComponent<TransformComponent>().position.x;
+						float currentX = zombie->getComponent<TransformComponent>().position.x; // i is the current zombie
 						float nextX = std::numeric_limits<float>::max();
 						int nextZombieIndex = -1;
 
 						for (size_t j = 0; j < rightToLeft.size(); ++j) {
-							if (!rightToLeft[j]->getComponent<TransformStatusComponent>().getTransformed()) {
-								float candidateX = rightToLeft[j]->getComponent<TransformComponent>().position.x;
+							Entity* candidate = rightToLeft[j].get();
+							if (candidate && !candidate->getComponent<TransformStatusComponent>().getTransformed()) {
+								float candidateX = candidate->getComponent<TransformComponent>().position.x;
 
 								// Looking for right of current zombie
 								if (candidateX > currentX && candidateX < nextX) {
@@ -1522,21 +1667,7 @@ void Game::update() {
 		}
 
 		// Check if all zombies are transformed
-		allZombiesTransformed = true; // Assume all are defeated
-
-		for (auto* zombie : leftToRight) {
-			if (!zombie->getComponent<TransformStatusComponent>().getTransformed()) {
-				allZombiesTransformed = false;
-				break;
-			}
-		}
-
-		for (auto* zombie : rightToLeft) {
-			if (!zombie->getComponent<TransformStatusComponent>().getTransformed()) {
-				allZombiesTransformed = false;
-				break;
-			}
-		}
+		allZombiesTransformed = allTransformed(leftToRight) && allTransformed(rightToLeft);
 
 		// Add delay to results screen
 		if (allZombiesTransformed && gameState == GameState::BONUS_STAGE) {
@@ -1649,10 +1780,10 @@ void Game::update() {
 			lastBlinkTime = currentTime;
 		}
 
-		// decrement wpmTimeRemaining
-		if (wpmTestStarted && currentTime > lastSecondTick + 1000 && wpmTimeRemaining > 0) {
-			wpmTimeRemaining--;
-			lastSecondTick = currentTime;
+		// Count down from the first keypress's timestamp
+		if (wpmTestStarted) {
+			Uint32 wpmElapsed = currentTime - wpmStartTime;
+			wpmTimeRemaining = wpmElapsed >= WPM_TEST_DURATION ? 0 : (WPM_TEST_DURATION - wpmElapsed + 999) / 1000;
 		}
 
 		// when timer hits 0, switch to wpm_results
@@ -1725,7 +1856,7 @@ void Game::render()
 		uiManager->drawText("Letter RIP", 650, 450, { 255, 255, 255, 255 }, titleFont);
 
 		if (showBlinkText) {
-			uiManager->drawText("Press Enter to Start!", 600, 525, { 255, 255, 255, 255 }, menuFont);
+			uiManager->drawCachedText("Press Enter to Start!", 600, 525, { 255, 255, 255, 255 }, menuFont);
 		}
 		SDL_RenderPresent(renderer);
 		break;
@@ -1924,7 +2055,9 @@ void Game::render()
 		lessonScrollX = typedWidth;
 
 		// Draw game objects
+		TextureManager::BeginBatch(); // Sprites sharing a texture go out in one call
 		manager.draw();
+		TextureManager::FlushBatch();
 
 		crosshair->getComponent<SpriteComponent>().draw();
 
@@ -1970,17 +2103,17 @@ void Game::render()
 		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
 		SDL_RenderClear(renderer);
 
-		uiManager->drawCenteredText("Lessons Results", 50, { 255, 255, 255, 255 }, titleFont, screenWidth);
+		uiManager->drawCachedCenteredText("Lessons Results", 50, { 255, 255, 255, 255 }, titleFont, screenWidth);
 
 		// Completion Message
 		if (lessonFullyCompleted) {
-			uiManager->drawText("Perfect Completion!", 400, 200, { 102, 255, 105, 255 }, menuFont);  // green
+			uiManager->drawCachedText("Perfect Completion!", 400, 200, { 102, 255, 105, 255 }, menuFont);  // green
 		}
 		else if (lessonPassed) {
-			uiManager->drawText("Lesson Passed! (Try for perfect!)", 400, 200, { 255, 255, 255, 255 }, menuFont);  // white
+			uiManager->drawCachedText("Lesson Passed! (Try for perfect!)", 400, 200, { 255, 255, 255, 255 }, menuFont);  // white
 		}
 		else {
-			uiManager->drawText("Lesson Failed... Try Again!", 400, 200, { 255, 80, 80, 255 }, menuFont);  // red
+			uiManager->drawCachedText("Lesson Failed... Try Again!", 400, 200, { 255, 80, 80, 255 }, menuFont);  // red
 		}
 
 		// Stats
@@ -1989,7 +2122,7 @@ void Game::render()
 		uiManager->drawText("Characters: " + std::to_string(lessonCorrectChars) + " / " + std::to_string(lessonIncorrectChars) + " (correct / incorrect)", 400, 650, { 255, 255, 255, 255 }, menuFont);
 
 		if (showBlinkText) {
-			uiManager->drawCenteredText("Press Enter to Return to the Lesson Selection Screen!", 800, { 255, 255, 255, 255 }, menuFont, screenWidth);
+			uiManager->drawCachedCenteredText("Press Enter to Return to the Lesson Selection Screen!", 800, { 255, 255, 255, 255 }, menuFont, screenWidth);
 		}
 
 		SDL_RenderPresent(renderer);
@@ -2052,15 +2185,16 @@ void Game::render()
 
 		// Draw map and game objects
 		map->drawMap(shakeOffsetX, shakeOffsetY);
+		TextureManager::BeginBatch(); // Sprites sharing a texture go out in one call
 		manager.draw();
+		TextureManager::FlushBatch();
 
 		// Render sprite hands over tombstones
 		leftHand->getComponent<SpriteComponent>().draw();
 		rightHand->getComponent<SpriteComponent>().draw();
 
 		// Render crosshair
-		if (!zombies.empty() && currentZombieIndex < zombies.size()) {
-			Entity* activeZombie = zombies[currentZombieIndex];
+		if (Entity* activeZombie = currentZombie(zombies)) {
 			auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 			// Place crosshair on top of current zombie
@@ -2071,107 +2205,15 @@ void Game::render()
 			crosshair->getComponent<SpriteComponent>().draw();
 		}
 
-		if (!allZombiesTransformed && currentZombieIndex < zombies.size()) {
+		if (Entity* activeZombie = allZombiesTransformed ? nullptr : currentZombie(zombies)) {
 			// Only render prompt if there are still zombies to be defeated
-			Entity* activeZombie = zombies[currentZombieIndex];
 			auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 			int zombieWidth = 32;
 			int zombieCenterX = static_cast<int>(zombieTransform.position.x + (zombieWidth));
 			int textY = static_cast<int>(zombieTransform.position.y - 20); // Slightly above zombie
 
-			if (uiManager) {
-				SDL_Color rectColor = { 255, 178, 102, 255 };
-				TTF_Font* font = TTF_OpenFont("assets/PressStart2P.ttf", 16);
-
-				if (font) {
-					// Calculate total text width
-					int totalTextWidth = 0;
-					for (char c : targetText) {
-						int w, h;
-						TTF_SizeText(font, std::string(1, c).c_str(), &w, &h);
-						totalTextWidth += w;
-					}
-
-					// Center textX based on zombie sprite's center and the text width
-					int textX = zombieCenterX - (totalTextWidth / 2);
-
-					// Center background rectangle
-					int rectWidth = totalTextWidth + 20; // with some padding
-					uiManager->drawRectangle(textX - 10, textY - 5, rectWidth, 25, rectColor);
-
-					// Render letters with spacing
-					int letterX = textX;
-					int cursorX = textX;
-
-					for (size_t i = 0; i < targetText.size(); ++i) {
-						SDL_Color color = { 255, 255, 255, 255 }; // Default to white
-						if (i < userInput.size()) {
-							if (userInput[i] == targetText[i]) {
-								color = { 0, 255, 0, 255 }; // Green for correct input
-							}
-							else if (!processedInput[i]) {
-								color = { 255, 0, 0, 255 }; // Red for incorrect input
-
-								processedInput[i] = true;
-							}
-							else if (processedInput[i]) {
-								color = { 255, 0, 0, 255 }; // Keep red for already processed incorrect input
-							}
-						}
-
-						std::string letter(1, targetText[i]);
-						SDL_Surface* surface = TTF_RenderText_Solid(font, letter.c_str(), color);
-						if (surface) {
-							SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-							if (texture) {
-								SDL_Rect dst = { letterX, textY, surface->w, surface->h };
-								SDL_RenderCopy(renderer, texture, nullptr, &dst);
-
-								letterX += surface->w + 1;
-
-								// Update cursorX after rendering the letter
-								if (i + 1 == userInput.size()) {
-									cursorX = letterX - 2;
-								}
-
-								SDL_DestroyTexture(texture);
-							}
-							SDL_FreeSurface(surface);
-						}
-					}
-
-					// Handle fully typed case cursor at end
-					if (userInput.size() == targetText.size()) {
-						cursorX = letterX; // After last letter
-					}
-
-					// Draw cursor
-					if (showCursor && userInput.size() <= targetText.size()) {
-						// Change caret color if input is fully typed but incorrect
-						SDL_Color caretColor = { 255, 255, 255, 255 }; // Default to white
-
-						if (userInput.size() == targetText.size() && userInput != targetText) {
-							caretColor = { 255, 0, 0, 255 }; // Red for incorrect full word
-						}
-
-						int caretWidth = 2;
-						int caretHeight = 18;
-
-						SDL_Rect caretRect = {
-							cursorX,
-							textY,
-							caretWidth,
-							caretHeight
-						};
-
-						SDL_SetRenderDrawColor(renderer, caretColor.r, caretColor.g, caretColor.b, caretColor.a);
-						SDL_RenderFillRect(renderer, &caretRect);
-					}
-
-					TTF_CloseFont(font);
-				}
-			}
+			renderPrompt(zombieCenterX, textY);
 		}
 
 		// These are lower so they are drawn over the zombies!
@@ -2217,8 +2259,8 @@ void Game::render()
 		uiManager->drawCenteredText("Round " + std::to_string(level), 10, { 0, 0, 0, 255 }, roundFont, screenWidth);
 
 		// Draw laser power-up!
-		if (laserActive) {
-			laserPowerup->getComponent<SpriteComponent>().Play("Laser");
+		if (Entity* laser = laserActive ? laserPowerup.get() : nullptr) {
+			laser->getComponent<SpriteComponent>().Play(ANIM_LASER);
 		}
 
 		// Draw exclamation point above player when barrier is destroyed
@@ -2240,7 +2282,7 @@ void Game::render()
 
 
 		if (showBlinkText) {
-			uiManager->drawText("Press Enter to Start Bonus Round...", 500, 750, { 255, 255, 255, 255 }, menuFont);
+			uiManager->drawCachedText("Press Enter to Start Bonus Round...", 500, 750, { 255, 255, 255, 255 }, menuFont);
 		}
 
 		SDL_RenderPresent(renderer);
@@ -2258,7 +2300,9 @@ void Game::render()
 
 		// Draw map and game objects
 		map->drawMap();
+		TextureManager::BeginBatch(); // Sprites sharing a texture go out in one call
 		manager.draw();
+		TextureManager::FlushBatch();
 
 		// Draw sprite hands
 		leftHand->getComponent<SpriteComponent>().draw();
@@ -2266,8 +2310,7 @@ void Game::render()
 
 		// Render crosshair on left group first
 		if (!leftGroupDefeated) {
-			if (!leftToRight.empty() && currentZombieIndex < leftToRight.size()) {
-				Entity* activeZombie = leftToRight[currentZombieIndex];
+			if (Entity* activeZombie = currentZombie(leftToRight)) {
 				auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 				// Place crosshair on top of current zombie
@@ -2279,8 +2322,7 @@ void Game::render()
 			}
 		}
 		else {
-			if (!rightToLeft.empty() && currentZombieIndex < rightToLeft.size()) {
-				Entity* activeZombie = rightToLeft[currentZombieIndex];
+			if (Entity* activeZombie = currentZombie(rightToLeft)) {
 				auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 				// Place crosshair on top of current zombie
@@ -2294,211 +2336,27 @@ void Game::render()
 
 		// Render prompt on left group first
 		if (!leftGroupDefeated) {
-			if (!allZombiesTransformed && currentZombieIndex < leftToRight.size()) {
+			if (Entity* activeZombie = allZombiesTransformed ? nullptr : currentZombie(leftToRight)) {
 				// Only render prompt if there are still zombies to be defeated
-				Entity* activeZombie = leftToRight[currentZombieIndex];
 				auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 				int zombieWidth = 32;
 				int zombieCenterX = static_cast<int>(zombieTransform.position.x + (zombieWidth));
 				int textY = static_cast<int>(zombieTransform.position.y - 20); // Slightly above zombie
 
-				if (uiManager) {
-					SDL_Color rectColor = { 255, 178, 102, 255 };
-					TTF_Font* font = TTF_OpenFont("assets/PressStart2P.ttf", 16);
-
-					if (font) {
-						// Calculate total text width
-						int totalTextWidth = 0;
-						for (char c : targetText) {
-							int w, h;
-							TTF_SizeText(font, std::string(1, c).c_str(), &w, &h);
-							totalTextWidth += w;
-						}
-
-						// Center textX based on zombie sprite's center and the text width
-						int textX = zombieCenterX - (totalTextWidth / 2);
-
-						// Center background rectangle
-						int rectWidth = totalTextWidth + 20; // With some padding
-						uiManager->drawRectangle(textX - 10, textY - 5, rectWidth, 25, rectColor);
-
-						// Render letters with spacing
-						int letterX = textX;
-						int cursorX = textX;
-
-						for (size_t i = 0; i < targetText.size(); ++i) {
-							SDL_Color color = { 255, 255, 255, 255 }; // Default to white
-							if (i < userInput.size()) {
-								if (userInput[i] == targetText[i]) {
-									color = { 0, 255, 0, 255 }; // Green for correct input
-								}
-								else if (!processedInput[i]) {
-									color = { 255, 0, 0, 255 }; // Red for incorrect input
-
-									processedInput[i] = true;
-								}
-								else if (processedInput[i]) {
-									color = { 255, 0, 0, 255 }; // Keep red for already processed incorrect input
-								}
-							}
-
-							std::string letter(1, targetText[i]);
-							SDL_Surface* surface = TTF_RenderText_Solid(font, letter.c_str(), color);
-							if (surface) {
-								SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-								if (texture) {
-									SDL_Rect dst = { letterX, textY, surface->w, surface->h };
-									SDL_RenderCopy(renderer, texture, nullptr, &dst);
-
-									letterX += surface->w + 1;
-
-									// Update cursorX AFTER rendering the letter
-									if (i + 1 == userInput.size()) {
-										cursorX = letterX - 2;
-									}
-
-									SDL_DestroyTexture(texture);
-								}
-								SDL_FreeSurface(surface);
-							}
-						}
-
-						// Handle fully typed case cursor at end
-						if (userInput.size() == targetText.size()) {
-							cursorX = letterX; // After last letter
-						}
-
-						// Draw cursor
-						if (showCursor && userInput.size() <= targetText.size()) {
-							// Change caret color if input is fully typed but incorrect
-							SDL_Color caretColor = { 255, 255, 255, 255 }; // Default to white
-
-							if (userInput.size() == targetText.size() && userInput != targetText) {
-								caretColor = { 255, 0, 0, 255 }; // Red for incorrect full word
-							}
-
-							int caretWidth = 2;
-							int caretHeight = 18;
-
-							SDL_Rect caretRect = {
-								cursorX,
-								textY,
-								caretWidth,
-								caretHeight
-							};
-
-							SDL_SetRenderDrawColor(renderer, caretColor.r, caretColor.g, caretColor.b, caretColor.a);
-							SDL_RenderFillRect(renderer, &caretRect);
-						}
-
-						TTF_CloseFont(font);
-					}
-				}
+				renderPrompt(zombieCenterX, textY);
 			}
 		}
 		else {
-			if (!allZombiesTransformed && currentZombieIndex < rightToLeft.size()) {
+			if (Entity* activeZombie = allZombiesTransformed ? nullptr : currentZombie(rightToLeft)) {
 				// Only render prompt if there are still zombies to be defeated
-				Entity* activeZombie = rightToLeft[currentZombieIndex];
 				auto& zombieTransform = activeZombie->getComponent<TransformComponent>();
 
 				int zombieWidth = 32;
 				int zombieCenterX = static_cast<int>(zombieTransform.position.x + (zombieWidth));
 				int textY = static_cast<int>(zombieTransform.position.y - 20); // Slightly above zombie
 
-				if (uiManager) {
-					SDL_Color rectColor = { 255, 178, 102, 255 };
-					TTF_Font* font = TTF_OpenFont("assets/PressStart2P.ttf", 16);
-
-					if (font) {
-						// Calculate total text width
-						int totalTextWidth = 0;
-						for (char c : targetText) {
-							int w, h;
-							TTF_SizeText(font, std::string(1, c).c_str(), &w, &h);
-							totalTextWidth += w;
-						}
-
-						// Center textX based on zombie sprite's center and the text width
-						int textX = zombieCenterX - (totalTextWidth / 2);
-
-						// Center background rectangle
-						int rectWidth = totalTextWidth + 20; // With some padding
-						uiManager->drawRectangle(textX - 10, textY - 5, rectWidth, 25, rectColor);
-
-						// Render letters with spacing
-						int letterX = textX;
-						int cursorX = textX;
-
-						for (size_t i = 0; i < targetText.size(); ++i) {
-							SDL_Color color = { 255, 255, 255, 255 }; // Default to white
-							if (i < userInput.size()) {
-								if (userInput[i] == targetText[i]) {
-									color = { 0, 255, 0, 255 }; // Green for correct input
-								}
-								else if (!processedInput[i]) {
-									color = { 255, 0, 0, 255 }; // Red for incorrect input
-
-									processedInput[i] = true;
-								}
-								else if (processedInput[i]) {
-									color = { 255, 0, 0, 255 }; // Keep red for already processed incorrect input
-								}
-							}
-
-							std::string letter(1, targetText[i]);
-							SDL_Surface* surface = TTF_RenderText_Solid(font, letter.c_str(), color);
-							if (surface) {
-								SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-								if (texture) {
-									SDL_Rect dst = { letterX, textY, surface->w, surface->h };
-									SDL_RenderCopy(renderer, texture, nullptr, &dst);
-
-									letterX += surface->w + 1;
-
-									// Update cursorX AFTER rendering the letter
-									if (i + 1 == userInput.size()) {
-										cursorX = letterX - 2;
-									}
-
-									SDL_DestroyTexture(texture);
-								}
-								SDL_FreeSurface(surface);
-							}
-						}
-
-						// Handle fully typed case cursor at end
-						if (userInput.size() == targetText.size()) {
-							cursorX = letterX; // After last letter
-						}
-
-						// Draw cursor
-						if (showCursor && userInput.size() <= targetText.size()) {
-							// Change caret color if input is fully typed but incorrect
-							SDL_Color caretColor = { 255, 255, 255, 255 }; // Default to white
-
-							if (userInput.size() == targetText.size() && userInput != targetText) {
-								caretColor = { 255, 0, 0, 255 }; // Red for incorrect full word
-							}
-
-							int caretWidth = 2;
-							int caretHeight = 18;
-
-							SDL_Rect caretRect = {
-								cursorX,
-								textY,
-								caretWidth,
-								caretHeight
-							};
-
-							SDL_SetRenderDrawColor(renderer, caretColor.r, caretColor.g, caretColor.b, caretColor.a);
-							SDL_RenderFillRect(renderer, &caretRect);
-						}
-
-						TTF_CloseFont(font);
-					}
-				}
+				renderPrompt(zombieCenterX, textY);
 			}
 		}
 
@@ -2581,13 +2439,13 @@ void Game::render()
 
 		overallAccuracy = "Level Accuracy: " + formatPercentage(levelAccuracy);
 
-		uiManager->drawText("Level " + std::to_string(level) + " Results!", 625, 50, { 255, 255, 255, 255 }, titleFont);
+		uiManager->drawCachedText("Level " + std::to_string(level) + " Results!", 625, 50, { 255, 255, 255, 255 }, titleFont);
 		uiManager->drawText(hpResults, 40, 200, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText(finalWrongResults, 40, 400, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText(overallAccuracy, 40, 600, { 255, 255, 255, 255 }, menuFont);
 
 		if (showBlinkText) {
-			uiManager->drawText("Press Enter to Start the Next Level!", 500, 750, { 255, 255, 255, 255 }, menuFont);
+			uiManager->drawCachedText("Press Enter to Start the Next Level!", 500, 750, { 255, 255, 255, 255 }, menuFont);
 		}
 
 		SDL_RenderPresent(renderer);
@@ -2629,14 +2487,14 @@ void Game::render()
 
 		overallAccuracy = "Level Accuracy: " + formatPercentage(levelAccuracy);
 
-		uiManager->drawText("Bonus Stage Results!", 560, 50, { 255, 255, 255, 255 }, titleFont);
+		uiManager->drawCachedText("Bonus Stage Results!", 560, 50, { 255, 255, 255, 255 }, titleFont);
 		uiManager->drawText(hpResults, 40, 200, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText(finalWrongResults, 40, 300, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText(totalBonusZombiesDefeated, 40, 400, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText(overallAccuracy, 40, 500, { 255, 255, 255, 255 }, menuFont);
 
 		if (showBlinkText) {
-			uiManager->drawText("Press Enter to Start the Next Level!", 500, 750, { 255, 255, 255, 255 }, menuFont);
+			uiManager->drawCachedText("Press Enter to Start the Next Level!", 500, 750, { 255, 255, 255, 255 }, menuFont);
 		}
 
 		SDL_RenderPresent(renderer);
@@ -2658,14 +2516,14 @@ void Game::render()
 		uiManager->drawText("GAME", 600, 100, { 255, 255, 255, 255 }, gameOverFont);
 		uiManager->drawText("OVER!", 575, 300, { 255, 255, 255, 255 }, gameOverFont);
 		if (showBlinkText && level == arcadeHighestLevel) {
-			uiManager->drawCenteredText("NEW RECORD!", 450, { 255, 255, 255, 255 }, menuFont, screenWidth);
+			uiManager->drawCachedCenteredText("NEW RECORD!", 450, { 255, 255, 255, 255 }, menuFont, screenWidth);
 		}
 		uiManager->drawText("Highest Level Reached: " + std::to_string(level), 600, 500, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText("Total Zombies Defeated: " + std::to_string(zombiesDefeated), 600, 550, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText(overallAccuracy, 600, 600, { 255, 255, 255, 255 }, menuFont);
 
 		if (showBlinkText) {
-			uiManager->drawText("Press Enter to Return to the Title Screen...", 400, 750, { 255, 255, 255, 255 }, menuFont);
+			uiManager->drawCachedText("Press Enter to Return to the Title Screen...", 400, 750, { 255, 255, 255, 255 }, menuFont);
 		}
 
 		SDL_RenderPresent(renderer);
@@ -2677,25 +2535,25 @@ void Game::render()
 		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
 		SDL_RenderClear(renderer);
 
-		uiManager->drawCenteredText("Records", 50, { 255, 255, 255, 255 }, titleFont, screenWidth);
+		uiManager->drawCachedCenteredText("Records", 50, { 255, 255, 255, 255 }, titleFont, screenWidth);
 
 		title = getTypingTitle(highestWpm);
 
-		uiManager->drawCenteredText("Current Title: " + title, 150, { 255, 255, 255, 255 }, menuFont, screenWidth);
+		uiManager->drawCachedCenteredText("Current Title: " + title, 150, { 255, 255, 255, 255 }, menuFont, screenWidth);
 
 		// Add in how many time each mode was played
 
 		// Lessons Mode Accuracy
-		uiManager->drawText("Lessons Mode Total Accuracy: " + formatPercentage(recordsLessonAccuracy), 100, 300, {255, 255, 255, 255}, menuFont);
+		uiManager->drawCachedText("Lessons Mode Total Accuracy: " + formatPercentage(recordsLessonAccuracy), 100, 300, {255, 255, 255, 255}, menuFont);
 
 		// Arcade Mode Accuracy
-		uiManager->drawText("Arcade Mode Total Accuracy: " + formatPercentage(recordsArcadeAccuracy), 100, 350, {255, 255, 255, 255}, menuFont);
+		uiManager->drawCachedText("Arcade Mode Total Accuracy: " + formatPercentage(recordsArcadeAccuracy), 100, 350, {255, 255, 255, 255}, menuFont);
 
 		// WPM Test Accuracy
-		uiManager->drawText("WPM Test Total Accuracy: " + formatPercentage(recordsWpmAccuracy), 100, 400, {255, 255, 255, 255}, menuFont);
+		uiManager->drawCachedText("WPM Test Total Accuracy: " + formatPercentage(recordsWpmAccuracy), 100, 400, {255, 255, 255, 255}, menuFont);
 
 		// Overall accuracy of every mode
-		uiManager->drawText("Overall Accuracy: " + formatPercentage(recordsOverallAccuracy), 100, 450, {255, 255, 255, 255}, menuFont);
+		uiManager->drawCachedText("Overall Accuracy: " + formatPercentage(recordsOverallAccuracy), 100, 450, {255, 255, 255, 255}, menuFont);
 
 		// Lessons completed
 		lessonsCompleted = 0;
@@ -2709,13 +2567,13 @@ void Game::render()
 		uiManager->drawText(lessonSummary, 100, 500, { 255, 255, 255, 255 }, menuFont);
 
 		// Highest arcade level achieved
-		uiManager->drawText("Highest Arcade Level: " + std::to_string(arcadeHighestLevel), 100, 550, { 255, 255, 255, 255 }, menuFont);
+		uiManager->drawCachedText("Highest Arcade Level: " + std::to_string(arcadeHighestLevel), 100, 550, { 255, 255, 255, 255 }, menuFont);
 
 		// Highest WPM test score
-		uiManager->drawText("Highest WPM Score: " + std::to_string(highestWpm), 100, 600, { 255, 255, 255, 255 }, menuFont);
+		uiManager->drawCachedText("Highest WPM Score: " + std::to_string(highestWpm), 100, 600, { 255, 255, 255, 255 }, menuFont);
 
 		// Characters typed wrong in every mode
-		uiManager->drawText("Incorrect Characters:", 1000, 300, { 255, 255, 255, 255 }, menuFont);
+		uiManager->drawCachedText("Incorrect Characters:", 1000, 300, { 255, 255, 255, 255 }, menuFont);
 
 		// Copy map contents into a vector for sorting
 		sortedWrongCharacters.assign(lifetimeWrongCharacters.begin(), lifetimeWrongCharacters.end());
@@ -2750,7 +2608,7 @@ void Game::render()
 		}
 
 		if (showBlinkText) {
-			uiManager->drawCenteredText("Press ESC to return to the Main Menu!", 800, { 255, 255, 255, 255 }, menuFont, screenWidth);
+			uiManager->drawCachedCenteredText("Press ESC to return to the Main Menu!", 800, { 255, 255, 255, 255 }, menuFont, screenWidth);
 		}
 
 		SDL_RenderPresent(renderer);
@@ -2792,33 +2650,24 @@ void Game::render()
 		}
 
 		// Render current line
-		for (size_t i = 0; i < wpmCurrentLine.size(); ++i) {
-			SDL_Color color = neutral;
-
-			if (i < wpmUserInput.size()) {
-				if (wpmUserInput[i] == wpmCurrentLine[i]) color = correct;
-				else color = wrong;
-			}
+		if (GlyphAtlas* atlas = uiManager->getAtlas(menuFont)) {
+			for (size_t i = 0; i < wpmCurrentLine.size(); ++i) {
+				SDL_Color color = neutral;
 
-			std::string letter(1, wpmCurrentLine[i]);
-			SDL_Surface* surface = TTF_RenderText_Solid(menuFont, letter.c_str(), color);
-			if (surface) {
-				SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-				if (texture) {
-					SDL_Rect dst = { letterX, middleLineY, surface->w, surface->h };
-					SDL_RenderCopy(renderer, texture, nullptr, &dst);
-
-					letterX += surface->w + 1;
+				if (i < wpmUserInput.size()) {
+					if (wpmUserInput[i] == wpmCurrentLine[i]) color = correct;
+					else color = wrong;
+				}
 
-					// Update cursor position after last typed character
-					if (i + 1 == wpmUserInput.size()) {
-						cursorX = letterX - 2;
-					}
+				letterX = atlas->addText(&wpmCurrentLine[i], 1, letterX, middleLineY, color) + 1;
 
-					SDL_DestroyTexture(texture);
+				// Update cursor position after last typed character
+				if (i + 1 == wpmUserInput.size()) {
+					cursorX = letterX - 2;
 				}
-				SDL_FreeSurface(surface);
 			}
+
+			atlas->flush();
 		}
 
 		// Handle case where full line is typed
@@ -2853,16 +2702,16 @@ void Game::render()
 		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
 		SDL_RenderClear(renderer);
 
-		uiManager->drawCenteredText("Words Per Minute Test Results", 100, { 255, 255, 255, 255 }, titleFont, screenWidth);
+		uiManager->drawCachedCenteredText("Words Per Minute Test Results", 100, { 255, 255, 255, 255 }, titleFont, screenWidth);
 
-		uiManager->drawText("Time: 60 seconds", 400, 300, { 255, 255, 255, 255 }, menuFont);
+		uiManager->drawCachedText("Time: 60 seconds", 400, 300, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText("Raw WPM: " + std::to_string((int)rawWpm), 400, 400, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText("Accuracy: " + std::to_string((int)(wpmAccuracy * 100)) + "%", 400, 500, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText("Overall WPM: " + std::to_string((int)wpm), 400, 600, { 255, 255, 255, 255 }, menuFont);
 		uiManager->drawText("Characters: " + std::to_string(wpmCorrectChars) + " / " + std::to_string(wpmIncorrectChars) + " (correct / incorrect)", 400, 700, {255, 255, 255, 255}, menuFont);
 
 		if (showBlinkText) {
-			uiManager->drawCenteredText("Press Enter to Return to the Main Menu!", 800, { 255, 255, 255, 255 }, menuFont, screenWidth);
+			uiManager->drawCachedCenteredText("Press Enter to Return to the Main Menu!", 800, { 255, 255, 255, 255 }, menuFont, screenWidth);
 		}
 
 		SDL_RenderPresent(renderer);
@@ -2889,15 +2738,29 @@ void Game::render()
 	default:
 		break;
 	}
-
-	SDL_RenderPresent(renderer);
 }
 
 void Game::clean()
 {
 	// Clean game/free memory on exit
 
+	inputManager.stopKeystrokeCapture();
+	prefetcher.stop();
+
+	std::cout << "Input stats: peak " << inputManager.getPeakEventsProcessed() << " events/frame, peak queue depth "
+		<< inputManager.getPeakQueueDepth() << std::endl;
+	std::cout << "Keystroke latency: avg " << inputManager.getAverageKeystrokeLatency() << " ms, peak "
+		<< inputManager.getPeakKeystrokeLatency() << " ms, " << inputManager.getDroppedKeystrokes() << " dropped" << std::endl;
+
+	std::cout << "Texture cache: " << TextureManager::getCachedCount() << " textures, " << TextureManager::getLoadCount()
+		<< " loads, " << TextureManager::getHitCount() << " hits" << std::endl;
+
+	std::cout << "Text cache: " << uiManager->getTextCacheHits() << " hits, " << uiManager->getTextCacheMisses()
+		<< " misses, " << uiManager->getTextCacheBytes() / 1024 << " KB resident" << std::endl;
+
 	delete uiManager;
+	fingerHints.release();
+	TextureManager::Clear();
 	SDL_DestroyWindow(window);
 	SDL_DestroyRenderer(renderer);
 	TTF_Quit();
@@ -2925,6 +2788,7 @@ void Game::resetLessonsMode(WordListManager::Difficulty lessonDifficulty)
 	background = &manager.addEntity();
 	background->addComponent<TransformComponent>(0, 150, 1600, 600, 1);
 	background->addComponent<SpriteComponent>("assets/Lessons_Background.png");
+	background->getComponent<SpriteComponent>().setLayer(LAYER_BACKGROUND);
 
 	// Create fresh zombies
 	zombie1 = &manager.addEntity();
@@ -2947,20 +2811,24 @@ void Game::resetLessonsMode(WordListManager::Difficulty lessonDifficulty)
 	leftHand = &manager.addEntity();
 	leftHand->addComponent<TransformComponent>(545, 770, 64, 64, 2);
 	leftHand->addComponent<SpriteComponent>("assets/Left_Hand.png");
+	leftHand->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	rightHand = &manager.addEntity();
 	rightHand->addComponent<TransformComponent>(930, 770, 64, 64, 2);
 	rightHand->addComponent<SpriteComponent>("assets/Right_Hand.png");
+	rightHand->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	// Initialize crosshair entity
 	crosshair = &manager.addEntity();
 	crosshair->addComponent<TransformComponent>(0, 0); // Initial position of crosshair
 	crosshair->addComponent<SpriteComponent>("assets/Crosshair.png");
+	crosshair->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	// Middle laser cannon
 	laserMiddle = &manager.addEntity();
 	laserMiddle->addComponent<TransformComponent>(laserX, 150, 68, 68, 2);
 	laserMiddle->addComponent<SpriteComponent>("assets/Laser_Cannon_Middle.png");
+	laserMiddle->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	// Clear word list and current line (in case they have words loaded in)
 	lessonWords.clear();
@@ -2979,8 +2847,8 @@ void Game::resetLessonsMode(WordListManager::Difficulty lessonDifficulty)
 	std::cout << "Lesson initialized with " << lessonWords.size() << " words." << std::endl;
 
 	// Reset hand sprites
-	currentLeftTex = "";
-	currentRightTex = "";
+	currentLeftPose = HandPose::COUNT;
+	currentRightPose = HandPose::COUNT;
 
 	// Reset user input
 	lessonUserInput.clear();
@@ -3084,8 +2952,8 @@ void Game::exitLessonsMode()
 	//lessonStartTime = SDL_GetTicks(); // Marks the fresh start of the lesson
 
 	// Reset hand sprites
-	currentLeftTex = "";
-	currentRightTex = "";
+	currentLeftPose = HandPose::COUNT;
+	currentRightPose = HandPose::COUNT;
 
 	// Reset typed chars
 	lessonCorrectChars = 0;
@@ -3123,35 +2991,47 @@ void Game::calculateLessonResults() {
 void Game::resetArcadeMode()
 {
 	// Remove zombie entities
-	for (auto* zombie : zombies) {
+	for (auto& zombie : zombies) {
+		Entity* e = zombie.get();
+		if (!e) continue; // Already gone
+
 		// Reset zombie sprite and transformation status
-		zombie->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
-		zombie->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
-		zombie->destroy(); // Mark zombie entity for removal
+		e->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
+		e->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
+		e->destroy(); // Mark zombie entity for removal
 	}
 	zombies.clear(); // Clear the zombies vector
 
-	for (auto* zombie : leftToRight) {
+	for (auto& zombie : leftToRight) {
+		Entity* e = zombie.get();
+		if (!e) continue; // Already gone
+
 		// Reset zombie sprite and transformation status
-		zombie->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
-		zombie->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
-		zombie->destroy(); // Mark zombie entity for removal
+		e->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
+		e->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
+		e->destroy(); // Mark zombie entity for removal
 	}
 	leftToRight.clear(); // Clear the zombies vector
 
-	for (auto* zombie : rightToLeft) {
+	for (auto& zombie : rightToLeft) {
+		Entity* e = zombie.get();
+		if (!e) continue; // Already gone
+
 		// Reset zombie sprite and transformation status
-		zombie->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
-		zombie->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
-		zombie->destroy(); // Mark zombie entity for removal
+		e->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
+		e->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
+		e->destroy(); // Mark zombie entity for removal
 	}
 	rightToLeft.clear(); // Clear the zombies vector
 
 	// Remove tombstone entities
-	for (auto* tombstone : tombstones) {
-		tombstone->destroy(); // Mark tombstone entity for removal
+	for (auto& tombstone : tombstones) {
+		if (Entity* e = tombstone.get()) {
+			e->destroy(); // Mark tombstone entity for removal
+		}
 	}
 	tombstones.clear(); // Clear the tombstone vector
+	map->clearDecals();
 
 	// Clean up previous entities if they exist
 	if (barrier) { barrier->destroy(); barrier = nullptr; }
@@ -3170,127 +3050,75 @@ void Game::resetArcadeMode()
 	leftHand = &manager.addEntity();
 	leftHand->addComponent<TransformComponent>(545, 770, 64, 64, 2);
 	leftHand->addComponent<SpriteComponent>("assets/Left_Hand.png");
+	leftHand->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	rightHand = &manager.addEntity();
 	rightHand->addComponent<TransformComponent>(930, 770, 64, 64, 2);
 	rightHand->addComponent<SpriteComponent>("assets/Right_Hand.png");
+	rightHand->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	// Barrier orb
 	barrier = &manager.addEntity();
 	barrier->addComponent<TransformComponent>(barrierX, 640, 64, 64, 2);
 	barrier->addComponent<SpriteComponent>("assets/Barrier_Orb_0.png");
+	barrier->getComponent<SpriteComponent>().setLayer(LAYER_GROUND); // Zombies attacking it stay on top
 	barrier->addComponent<ColliderComponent>("barrier");
 
 	// Initialize crosshair entity
 	crosshair = &manager.addEntity();
 	crosshair->addComponent<TransformComponent>(0, 0); // Initial position of crosshair
 	crosshair->addComponent<SpriteComponent>("assets/crosshair.png");
+	crosshair->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	// Middle laser cannon
 	laserMiddle = &manager.addEntity();
 	laserMiddle->addComponent<TransformComponent>(laserX, 0, 68, 68, 2);
 	laserMiddle->addComponent<SpriteComponent>("assets/Laser_Cannon_Middle.png");
+	laserMiddle->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	// Left and right laser cannons
 	laserLeft = &manager.addEntity();
 	laserLeft->addComponent<TransformComponent>(0, 0, 64, 64, 2);
 	laserLeft->addComponent<SpriteComponent>("assets/Laser_Cannon_Left.png");
+	laserLeft->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	laserRight = &manager.addEntity();
 	laserRight->addComponent<TransformComponent>(1472, 0, 64, 64, 2);
 	laserRight->addComponent<SpriteComponent>("assets/Laser_Cannon_Right.png");
+	laserRight->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
 	// Combo meter
 	comboMeter = &manager.addEntity();
 	comboMeter->addComponent<TransformComponent>(1350, 785, 64, 32, 2);
 	comboMeter->addComponent<SpriteComponent>("assets/Combo_Meter_0.png");
+	comboMeter->getComponent<SpriteComponent>().setLayer(LAYER_UI);
 
-	// Initialize random seed for zombie spawn
+	// Initialize random seed for screen shake
 	std::srand(static_cast<unsigned int>(std::time(nullptr)));
 
 	// Reset zombie spawn mechanics
 	currentZombieIndex = 0;
 	allZombiesTransformed = false;
 
-	// Initial number of zombies to spawn
-	int numZombies = 3;
+	// First wave (3 easy zombies) was prepared in the background, ask for the one after it straight away
+	prefetcher.takeWave(0, wavePlan);
+	updateWordWeakness();
+	prefetcher.requestWave(1);
+	prefetcher.requestBonus(1);
 
-	// Spawn zombies at random off-screen positions but not too close to player
-	int spawnBuffer = 150; // Distance beyond game window for spawning
-	for (size_t i = 0; i < numZombies; ++i)
+	// Spawn zombies at the planned off-screen positions
+	for (const SDL_Point& spawn : wavePlan.spawns)
 	{
 		Entity* newZombie = &manager.addEntity();
-
-		int spawnEdge = rand() % 3; // 0: top, 1: left, 2: right
-		int x, y;
-		bool validSpawn = false;
-
-		while (!validSpawn) {
-			validSpawn = true;
-			switch (spawnEdge)
-			{
-			case 0: // Top
-				x = rand() % screenWidth; // Full width range
-				y = -spawnBuffer;
-				break;
-			case 1: // Left
-				x = -spawnBuffer;
-				y = rand() % 650; // Ensures zombies spawn above the barrier orb
-				break;
-			case 2: // Right
-				x = screenWidth + spawnBuffer; // Force outside screen bounds
-				y = rand() % 650; // Ensures zombies spawn above the barrier orb
-				break;
-			}
-
-			// Ensure zombie spawn is not too close to player
-			auto& playerTransform = player.getComponent<TransformComponent>();
-			float dx = playerTransform.position.x - x;
-			float dy = playerTransform.position.y - y;
-			if (sqrt(dx * dx + dy * dy) < 400.0f) {
-				validSpawn = false;
-				continue;
-			}
-
-			// Check distance to other zombies
-			for (Entity* otherZombie : zombies) {
-				auto& otherTransform = otherZombie->getComponent<TransformComponent>();
-				float odx = otherTransform.position.x - x;
-				float ody = otherTransform.position.y - y;
-				if (sqrt(odx * odx + ody * ody) < 70.0f) { // Radius for how far zombies spawn from each other
-					validSpawn = false;
-					break;
-				}
-			}
-		}
-
-		newZombie->addComponent<TransformComponent>(x, y);
+		newZombie->addComponent<TransformComponent>(spawn.x, spawn.y);
 		newZombie->addComponent<SpriteComponent>("assets/Zambie-Sheet.png", true);
-		newZombie->addComponent<ColliderComponent>("zombie");
+		newZombie->addComponent<ColliderComponent>("zombie").setGrid(&zombieGrid);
 		newZombie->addComponent<TransformStatusComponent>(); // Add transformation status
-		zombies.push_back(newZombie);
-	}
-
-	// Find the closest zombie to the player at game start
-	float closestDistance = std::numeric_limits<float>::max();
-	size_t closestZombieIndex = 0;
-
-	for (size_t i = 0; i < zombies.size(); ++i) {
-		if (!zombies[i]->getComponent<TransformStatusComponent>().getTransformed()) {
-			auto& zombieTransform = zombies[i]->getComponent<TransformComponent>();
-			float dx = player.getComponent<TransformComponent>().position.x - zombieTransform.position.x;
-			float dy = player.getComponent<TransformComponent>().position.y - zombieTransform.position.y;
-			float distance = sqrt(dx * dx + dy * dy);
-
-			if (distance < closestDistance) {
-				closestDistance = distance;
-				closestZombieIndex = i;
-			}
-		}
+		zombies.push_back(newZombie->handle());
 	}
 
-	// Set starting target
-	currentZombieIndex = closestZombieIndex;
+	// Find the closest zombie to the player at game start, and set it as the starting target
+	rankTargets();
 
 	// Intilalize zombies remaining
 
@@ -3301,23 +3129,25 @@ void Game::resetArcadeMode()
 
 	// Clear laser power-up if still active
 	if (laserActive) {
-		laserPowerup->destroy();
-		laserPowerup = nullptr;
+		if (Entity* laser = laserPowerup.get()) {
+			laser->destroy();
+		}
+		laserPowerup.reset();
 		laserActive = false;
 	}
 
 	// For stats
 	arcadeResultsStatsUpdated = false;
 
-	// Randomizing words
-	arcadeWords = wordManager.getRandomWords(WordListManager::EASY, numZombies);
+	// Randomized words that came with the wave
+	arcadeWords = wavePlan.words;
 
 	// Reset map visual
 	map->setDifficulty(MapLevel::EASY);
 
 	// Reset hand sprites
-	currentLeftTex = "";
-	currentRightTex = "";
+	currentLeftPose = HandPose::COUNT;
+	currentRightPose = HandPose::COUNT;
 
 	// Reset game variables
 
@@ -3368,35 +3198,47 @@ void Game::resetArcadeMode()
 void Game::exitArcadeMode()
 {
 	// Remove zombie entities
-	for (auto* zombie : zombies) {
+	for (auto& zombie : zombies) {
+		Entity* e = zombie.get();
+		if (!e) continue; // Already gone
+
 		// Reset zombie sprite and transformation status
-		zombie->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
-		zombie->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
-		zombie->destroy(); // Mark zombie entity for removal
+		e->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
+		e->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
+		e->destroy(); // Mark zombie entity for removal
 	}
 	zombies.clear(); // Clear the zombies vector
 
-	for (auto* zombie : leftToRight) {
+	for (auto& zombie : leftToRight) {
+		Entity* e = zombie.get();
+		if (!e) continue; // Already gone
+
 		// Reset zombie sprite and transformation status
-		zombie->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
-		zombie->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
-		zombie->destroy(); // Mark zombie entity for removal
+		e->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
+		e->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
+		e->destroy(); // Mark zombie entity for removal
 	}
 	leftToRight.clear(); // Clear the zombies vector
 
-	for (auto* zombie : rightToLeft) {
+	for (auto& zombie : rightToLeft) {
+		Entity* e = zombie.get();
+		if (!e) continue; // Already gone
+
 		// Reset zombie sprite and transformation status
-		zombie->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
-		zombie->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
-		zombie->destroy(); // Mark zombie entity for removal
+		e->getComponent<SpriteComponent>().setTex("assets/Zombie.png");  // Reset to normal zombie sprite
+		e->getComponent<TransformStatusComponent>().setTransformed(false); // Reset transformation status
+		e->destroy(); // Mark zombie entity for removal
 	}
 	rightToLeft.clear(); // Clear the zombies vector
 
 	// Remove tombstone entities
-	for (auto* tombstone : tombstones) {
-		tombstone->destroy(); // Mark tombstone entity for removal
+	for (auto& tombstone : tombstones) {
+		if (Entity* e = tombstone.get()) {
+			e->destroy(); // Mark tombstone entity for removal
+		}
 	}
 	tombstones.clear(); // Clear the tombstone vector
+	map->clearDecals();
 
 	// Cleaning up other entities...
 	if (barrier) { barrier->destroy(); barrier = nullptr; }
@@ -3417,8 +3259,11 @@ void Game::exitArcadeMode()
 	typedWrong.clear();
 
 	// Reset hand sprites
-	currentLeftTex = "";
-	currentRightTex = "";
+	currentLeftPose = HandPose::COUNT;
+	currentRightPose = HandPose::COUNT;
+
+	// The next run starts from wave 0 again, get it ready now instead of on the transition frame
+	prefetcher.requestWave(0);
 }
 
 // To set up next level of arcade mode
@@ -3439,8 +3284,8 @@ void Game::nextLevel()
 	// Update barrier sprite damage
 	updateBarrierDamage(barrierHP);
 
-	// Clear the previous round's zombies and reset zombie index and transformation status
-	zombies.clear();
+	// Clear the previous round's zombies (their corpses stay on the floor) and reset zombie index and transformation status
+	buryTombstones();
 	currentZombieIndex = 0;
 	allZombiesTransformed = false;
 
@@ -3449,109 +3294,45 @@ void Game::nextLevel()
 
 	// Clear laser power-up if still active
 	if (laserActive) {
-		laserPowerup->destroy();
-		laserPowerup = nullptr;
+		if (Entity* laser = laserPowerup.get()) {
+			laser->destroy();
+		}
+		laserPowerup.reset();
 		laserActive = false;
 	}
 
-	// Setting number of zombies to spawn, with a new one appearing every 5 levels
-	int numZombies = 3 + (level / 5);
-
-	// Randomizing words and updating difficulty every 10 levels 
-	int cycleLevel = (level % 30) + 1; // Ensures difficulty cycles every 30 rounds
+	// Take this round's wave (a new zombie every 5 levels, difficulty cycling every 30) and start on the next one
+	prefetcher.takeWave(level, wavePlan);
+	updateWordWeakness();
+	prefetcher.requestWave(level + 1);
 
-	if (cycleLevel <= 10) {
-		difficulty = WordListManager::EASY;
+	difficulty = wavePlan.difficulty;
+	if (difficulty == WordListManager::EASY) {
 		map->setDifficulty(MapLevel::EASY);
 	}
-	else if (cycleLevel <= 20) {
-		difficulty = WordListManager::MEDIUM;
+	else if (difficulty == WordListManager::MEDIUM) {
 		map->setDifficulty(MapLevel::MEDIUM);
 	}
 	else {
-		difficulty = WordListManager::HARD;
 		map->setDifficulty(MapLevel::HARD);
 	}
 
-	// Get random words for the next level, based on the current difficulty and number of zombies spawning
-	arcadeWords = wordManager.getRandomWords(difficulty, numZombies);
+	// Random words for the next level, based on the current difficulty and number of zombies spawning
+	arcadeWords = wavePlan.words;
 
-	// Spawn zombies at random off-screen positions but not too close to player
-	int spawnBuffer = 150; // Distance beyond game window for spawning
-	for (size_t i = 0; i < numZombies; ++i)
+	// Spawn zombies at the planned off-screen positions
+	for (const SDL_Point& spawn : wavePlan.spawns)
 	{
 		Entity* newZombie = &manager.addEntity();
-
-		int spawnEdge = rand() % 3; // 0: top, 1: left, 2: right
-		int x, y;
-		bool validSpawn = false;
-
-		while (!validSpawn) {
-			validSpawn = true;
-			switch (spawnEdge)
-			{
-			case 0: // Top
-				x = rand() % 1600; // Full width range
-				y = -spawnBuffer;
-				break;
-			case 1: // Left
-				x = -spawnBuffer;
-				y = rand() % 650; // Ensures zombies spawn above the barrier orb
-				break;
-			case 2: // Right
-				x = 1600 + spawnBuffer; // Force outside screen bounds
-				y = rand() % 650; // Ensures zombies spawn above the barrier orb
-				break;
-			}
-
-			// Ensure zombie spawn is not too close to player
-			auto& playerTransform = player.getComponent<TransformComponent>();
-			float dx = playerTransform.position.x - x;
-			float dy = playerTransform.position.y - y;
-			if (sqrt(dx * dx + dy * dy) < 400.0f) {
-				validSpawn = false;
-				continue;
-			}
-
-			// Check distance to other zombies
-			for (Entity* otherZombie : zombies) {
-				auto& otherTransform = otherZombie->getComponent<TransformComponent>();
-				float odx = otherTransform.position.x - x;
-				float ody = otherTransform.position.y - y;
-				if (sqrt(odx * odx + ody * ody) < 70.0f) { // May need to adjust radius
-					validSpawn = false;
-					break;
-				}
-			}
-		}
-
-		newZombie->addComponent<TransformComponent>(x, y);
+		newZombie->addComponent<TransformComponent>(spawn.x, spawn.y);
 		newZombie->addComponent<SpriteComponent>("assets/Zambie-Sheet.png", true);
-		newZombie->addComponent<ColliderComponent>("zombie");
+		newZombie->addComponent<ColliderComponent>("zombie").setGrid(&zombieGrid);
 		newZombie->addComponent<TransformStatusComponent>(); // Add transformation status
-		zombies.push_back(newZombie);
+		zombies.push_back(newZombie->handle());
 	}
 
-	// Find the closest zombie to the player at game start
-	float closestDistance = std::numeric_limits<float>::max();
-	size_t closestZombieIndex = 0;
-
-	for (size_t i = 0; i < zombies.size(); ++i) {
-		if (!zombies[i]->getComponent<TransformStatusComponent>().getTransformed()) {
-			auto& zombieTransform = zombies[i]->getComponent<TransformComponent>();
-			float dx = player.getComponent<TransformComponent>().position.x - zombieTransform.position.x;
-			float dy = player.getComponent<TransformComponent>().position.y - zombieTransform.position.y;
-			float distance = sqrt(dx * dx + dy * dy);
-
-			if (distance < closestDistance) {
-				closestDistance = distance;
-				closestZombieIndex = i;
-			}
-		}
-	}
-
-	// Set starting target
-	currentZombieIndex = closestZombieIndex;
+	// Find the closest zombie to the player at game start, and set it as the starting target
+	rankTargets();
 	targetText = arcadeWords[currentZombieIndex];
 
 	// For stats
@@ -3587,8 +3368,8 @@ void Game::nextLevel()
 	inBonusStage = false; // Reset the flag when exiting the bonus stage
 
 	// Reset hand sprites
-	currentLeftTex = "";
-	currentRightTex = "";
+	currentLeftPose = HandPose::COUNT;
+	currentRightPose = HandPose::COUNT;
 
 	std::cout << "Arcade mode setup for new round!" << std::endl;
 }
@@ -3597,8 +3378,7 @@ void Game::nextLevel()
 void Game::bonusStage()
 {
 	// Clear the previous round's zombies
-	leftToRight.clear();
-	rightToLeft.clear();
+	buryTombstones();
 	currentZombieIndex = 0;
 	allZombiesTransformed = false;
 
@@ -3607,26 +3387,29 @@ void Game::bonusStage()
 
 	// Clear laser power-up if still active
 	if (laserActive) {
-		laserPowerup->destroy();
-		laserPowerup = nullptr;
+		if (Entity* laser = laserPowerup.get()) {
+			laser->destroy();
+		}
+		laserPowerup.reset();
 		laserActive = false;
 	}
 
 	// Increasing bonus level
 	bonusLevel++;
 
-	// Keeping track of zombie count and increases each bonus round
-	int numZombiesLeft = 3 + (bonusLevel - 1);
-	int numZombiesRight = 3 + (bonusLevel - 1);
+	// Random letters and row heights for this bonus round were prepared in the background (rows grow each round)
+	prefetcher.takeBonus(bonusLevel, bonusPlan);
+	prefetcher.requestBonus(bonusLevel + 1);
 
-	// Randomize letters every new bonus round
-	bonusLeft = wordManager.getRandomWords(WordListManager::BONUSLEFT, numZombiesLeft);
-	bonusRight = wordManager.getRandomWords(WordListManager::BONUSRIGHT, numZombiesRight);
+	bonusLeft = bonusPlan.leftWords;
+	bonusRight = bonusPlan.rightWords;
+	int numZombiesLeft = static_cast<int>(bonusLeft.size());
+	int numZombiesRight = static_cast<int>(bonusRight.size());
 
 	int spacing = 120; // Space between zombies
 
-	// Generate random y-coordinate for left-to-right zombie row
-	int yLeft = 150 + (rand() % 360);
+	// Random y-coordinate for left-to-right zombie row
+	int yLeft = bonusPlan.yLeft;
 
 	// Left-to-Right group
 	for (int i = 0; i < numZombiesLeft; ++i)
@@ -3639,12 +3422,12 @@ void Game::bonusStage()
 		newZombie->addComponent<SpriteComponent>("assets/Zambie-Sheet.png", true);
 		newZombie->addComponent<ColliderComponent>("zombie");
 		newZombie->addComponent<TransformStatusComponent>(); // Add transformation status
-		leftToRight.push_back(newZombie);
+		leftToRight.push_back(newZombie->handle());
 		totalBonusZombies++;
 	}
 
-	// Generate random y-coordinate for right-to-left zombie row
-	int yRight = 150 + (rand() % 360);
+	// Random y-coordinate for right-to-left zombie row
+	int yRight = bonusPlan.yRight;
 
 	// Right-to-Left group
 	for (int i = 0; i < numZombiesRight; ++i)
@@ -3657,7 +3440,7 @@ void Game::bonusStage()
 		newZombie->addComponent<SpriteComponent>("assets/Zambie-Sheet.png", true);
 		newZombie->addComponent<ColliderComponent>("zombie");
 		newZombie->addComponent<TransformStatusComponent>(); // Add transformation status
-		rightToLeft.push_back(newZombie);
+		rightToLeft.push_back(newZombie->handle());
 		totalBonusZombies++;
 	}
 
@@ -3693,6 +3476,77 @@ void Game::bonusStage()
 	std::cout << "Zombies reset for bonus round!" << std::endl;
 }
 
+// Slide a bonus row's walking zombies along together, left group to the right and right group to the left
+void Game::moveBonusRow(bool leftGroup)
+{
+	std::vector<EntityHandle>& row = leftGroup ? leftToRight : rightToLeft;
+
+	seekBatch.clear();
+	for (auto [zombie, zombieTransform, transformStatus] : manager.view<TransformComponent, TransformStatusComponent>(row)) {
+		if (!transformStatus.getTransformed()) {
+			seekBatch.add(zombieTransform.position.x, zombieTransform.position.y);
+		}
+	}
+
+	Steering::translate(seekBatch, leftGroup ? bonusSpeed : -bonusSpeed, 0.0f);
+
+	size_t lane = 0;
+	for (auto [zombie, zombieTransform, transformStatus] : manager.view<TransformComponent, TransformStatusComponent>(row)) {
+		if (!transformStatus.getTransformed()) {
+			zombieTransform.position.x = seekBatch.x[lane];
+			zombieTransform.position.y = seekBatch.y[lane];
+			lane++;
+		}
+	}
+}
+
+// Rank a freshly spawned wave for targeting and aim at the best zombie
+void Game::rankTargets()
+{
+	auto& playerTransform = player.getComponent<TransformComponent>();
+	targetSelector.setPlayer(playerTransform.position.x, playerTransform.position.y);
+
+	if (barrier) {
+		const SDL_Rect& barrierRect = barrier->getComponent<ColliderComponent>().collider;
+		targetSelector.setBarrier(barrierRect.x + barrierRect.w / 2.0f, barrierRect.y + barrierRect.h / 2.0f);
+	}
+
+	targetSelector.reset(zombies.size());
+
+	// i is the zombie's slot in zombies, so each rank keeps its zombie's word even if a handle in the wave is empty
+	for (auto [i, zombie, zombieTransform, transformStatus] : manager.view<TransformComponent, TransformStatusComponent>(zombies).indexed()) {
+		if (!transformStatus.getTransformed()) {
+			targetSelector.update(i, zombieTransform.position.x, zombieTransform.position.y, false, transformStatus.isStunned());
+		}
+	}
+
+	int nextTarget = targetSelector.next();
+	currentZombieIndex = nextTarget >= 0 ? nextTarget : 0;
+}
+
+// Stamp the cleared wave's corpses into the map and free their entities, so finished waves cost nothing per frame
+void Game::buryTombstones()
+{
+	for (auto& tombstone : tombstones) {
+		Entity* corpse = tombstone.get();
+		if (!corpse) continue;
+
+		// Zombies that walked off screen never played their defeat clip, nothing to leave behind
+		auto& sprite = corpse->getComponent<SpriteComponent>();
+		if (!sprite.isLooping()) {
+			map->stampDecal(sprite.getTexture(), sprite.getLastFrameRect(), sprite.getDestRect());
+		}
+
+		corpse->destroy();
+	}
+	tombstones.clear();
+
+	// Every zombie of a cleared wave is a tombstone, so these only hold dead handles now
+	zombies.clear();
+	leftToRight.clear();
+	rightToLeft.clear();
+}
+
 // To update the barrier orb sprite based on how much damage has been taken
 void Game::updateBarrierDamage(int barrierHP) {
 	// Convert HP (0-100) to damage level (0-10)
@@ -3750,10 +3604,12 @@ void Game::checkCombo(const std::string& input, const std::string& target) {
 void Game::fireLaser() {
 	if (laserActive) return; // to prevent multiple lasers...
 
-	laserPowerup = &manager.addEntity();
-	laserPowerup->addComponent<TransformComponent>(65, 32, 1472, 64, 1);
-	laserPowerup->addComponent<SpriteComponent>("assets/Laser-Sheet.png", true);
-	laserPowerup->addComponent<ColliderComponent>("laser");
+	Entity& laser = manager.addEntity();
+	laser.addComponent<TransformComponent>(65, 32, 1472, 64, 1);
+	laser.addComponent<SpriteComponent>("assets/Laser-Sheet.png", true);
+	laser.getComponent<SpriteComponent>().setLayer(LAYER_EFFECTS);
+	laser.addComponent<ColliderComponent>("laser");
+	laserPowerup = laser.handle();
 
 	laserActive = true;
 }
@@ -3765,17 +3621,21 @@ void Game::resetWPMTest() {
 	std::cout << "WPM Test Reset!" << std::endl;
 	wpmTestStarted = false;
 	wpmTestEnded = false;
-	wpmTimeRemaining = 60;
-	lastSecondTick = 0;
+	wpmTimeRemaining = WPM_TEST_DURATION / 1000;
+	wpmStartTime = 0;
 	rawWpm = 0.0f;
 	wpmAccuracy = 0.0f;
 	wpm = 0.0f;
 	wpmCorrectChars = 0;
 	wpmTotalTypedChars = 0;
 	wpmIncorrectChars = 0;
-	wpmTopLine = ""; // Nothing typed yet
-	wpmCurrentLine = generateRandomLine();
-	wpmNextLine = generateRandomLine();
+	// Room for a full line in each buffer up front, so shifting lines never has to grow them
+	wpmTopLine.reserve(128);
+	wpmCurrentLine.reserve(128);
+	wpmNextLine.reserve(128);
+	wpmTopLine.clear(); // Nothing typed yet
+	generateRandomLine(wpmCurrentLine);
+	generateRandomLine(wpmNextLine);
 	wpmUserInput.clear();
 	// Reset letters typed incorrectly
 	typedWrong.clear();
@@ -3783,9 +3643,11 @@ void Game::resetWPMTest() {
 
 // Handles line shifting logic
 void Game::shiftWpmLines() {
-	wpmTopLine = wpmCurrentLine;
-	wpmCurrentLine = wpmNextLine;
-	wpmNextLine = generateRandomLine();
+	// Rotate the buffers instead of copying, the old top line's buffer gets the new line
+	std::swap(wpmTopLine, wpmCurrentLine);
+	std::swap(wpmCurrentLine, wpmNextLine);
+	generateRandomLine(wpmNextLine);
+	updateWordWeakness(); // Lines a few ahead start leaning on what was just missed
 	wpmUserInput.clear();
 }
 
@@ -3795,15 +3657,35 @@ int Game::countWords(const std::string& line) {
 	return std::distance(std::istream_iterator<std::string>(iss), std::istream_iterator<std::string>());
 }
 
-// Generates a random line of words for the WPM test
-std::string Game::generateRandomLine() {
-	std::vector<std::string> wpmWords = wordManager.getRandomWords(WordListManager::WPM, 12); // May need to adjust count so it doesn't overflow!
-	std::string line;
-	for (const auto& word : wpmWords) {
-		line += word + " ";
+// Tell the word sampler which characters the player misses most (lifetime misses, plus this session's until they're added in)
+void Game::updateWordWeakness() {
+	int misses[AdaptiveSampler::CHARACTERS] = {};
+	int mostMissed = 0;
+
+	for (const auto* wrongCounts : { &lifetimeWrongCharacters, &typedWrong }) {
+		for (const auto& [ch, count] : *wrongCounts) {
+			unsigned char c = static_cast<unsigned char>(ch);
+			if (c < AdaptiveSampler::CHARACTERS) {
+				int& total = misses[std::tolower(c)];
+				total += count;
+				mostMissed = std::max(mostMissed, total);
+			}
+		}
+	}
+
+	float weakness[AdaptiveSampler::CHARACTERS] = {};
+	if (mostMissed > 0 && !wordWeaknessIgnored) {
+		for (int c = 0; c < AdaptiveSampler::CHARACTERS; c++) {
+			weakness[c] = static_cast<float>(misses[c]) / mostMissed;
+		}
 	}
-	if (!line.empty()) line.pop_back(); // Remove trailing space
-	return line;
+
+	prefetcher.setWeakness(weakness);
+}
+
+// Swaps in the next random line of words for the WPM test (already built by the prefetcher, line's old buffer is reused)
+void Game::generateRandomLine(std::string& line) {
+	prefetcher.takeLine(line);
 }
 
 // To quickly calculate the WPM results and display it on the results screen
@@ -3862,83 +3744,194 @@ void Game::calculateAverageRecords()
 		: 0.0f;
 }
 
-// Shared method(s)
-// 
-// Key-to-finger sprite mapping
-void Game::updateHandSprites(const std::string& targetText, const std::string& userInput)
+// Benchmark hooks
+//
+// Jump straight into a mode, skipping the menus
+void Game::startMode(GameState mode, int arcadeLevel)
 {
-	if (userInput.size() >= targetText.size()) return;
-
-	char nextChar = targetText[userInput.size()];
-	std::string leftTex = "assets/Left_Hand.png";
-	std::string rightTex = "assets/Right_Hand.png";
+	exitLessonsMode();
+	exitArcadeMode();
 
-	// Determine which key was pressed and what fingers to show
-	switch (nextChar) {
-		// Left pinky
-	case 'q': case 'a': case 'z':
-		leftTex = "assets/Left_Pinky.png";
+	switch (mode) {
+	case GameState::LESSONS_MODE:
+		currentLessonDifficulty = WordListManager::LESSON_0;
+		resetLessonsMode(currentLessonDifficulty);
 		break;
 
-		// Left ring
-	case 'w': case 's': case 'x':
-		leftTex = "assets/Left_Ring.png";
-		break;
+	case GameState::ARCADE_MODE:
+		resetArcadeMode();
 
-		// Left middle
-	case 'e': case 'd': case 'c':
-		leftTex = "assets/Left_Middle.png";
+		if (arcadeLevel > 1) {
+			// Set the round up as if the one before it was just cleared (without its bonus stage)
+			for (auto& zombie : zombies) {
+				if (Entity* e = zombie.get()) {
+					e->destroy();
+				}
+			}
+			level = arcadeLevel - 1;
+			inBonusStage = true;
+			nextLevel();
+		}
 		break;
 
-		// Left index
-	case 'r': case 'f': case 'v':
-	case 't': case 'g': case 'b':
-		leftTex = "assets/Left_Index.png";
+	case GameState::BONUS_STAGE:
+		resetArcadeMode();
+		bonusStage();
 		break;
 
-		// Right index
-	case 'y': case 'h': case 'n':
-	case 'u': case 'j': case 'm':
-		rightTex = "assets/Right_Index.png";
+	case GameState::WPM_TEST:
+		resetWPMTest();
 		break;
 
-		// Right middle
-	case 'i': case 'k': case ',':
-		rightTex = "assets/Right_Middle.png";
+	default:
 		break;
+	}
 
-		// Right ring
-	case 'o': case 'l': case '.':
-		rightTex = "assets/Right_Ring.png";
+	gameState = mode;
+}
+
+// Reseed the prefetcher (every random word pick goes through it), so runs with the same seed type the same words
+void Game::seedWords(uint32_t seed)
+{
+	prefetcher.seed(seed);
+}
+
+void Game::ignoreWordWeakness()
+{
+	wordWeaknessIgnored = true;
+	updateWordWeakness();
+}
+
+GameState Game::getState() const
+{
+	return gameState;
+}
+
+std::string_view Game::getPendingInput() const
+{
+	const std::string* target = nullptr;
+	const std::string* typed = nullptr;
+
+	switch (gameState) {
+	case GameState::LESSONS_MODE:
+		target = &lessonCurrentLine;
+		typed = &lessonUserInput;
 		break;
 
-		// Right pinky
-	case 'p':
-		rightTex = "assets/Right_Pinky.png";
+	case GameState::ARCADE_MODE:
+	case GameState::BONUS_STAGE:
+		target = &targetText;
+		typed = &userInput;
 		break;
 
-		// Thumbs for space
-	case ' ':
-		leftTex = "assets/Left_Thumb.png";
-		rightTex = "assets/Right_Thumb.png";
+	case GameState::WPM_TEST:
+		target = &wpmCurrentLine;
+		typed = &wpmUserInput;
 		break;
 
 	default:
-		break;
+		return {};
 	}
 
-	// Only update textures if they have changed
-	currentLeftTex = "";
-	currentRightTex = "";
+	if (typed->size() >= target->size()) {
+		return {};
+	}
+	return std::string_view(*target).substr(typed->size());
+}
+
+// Shared method(s)
+// 
+// Key-to-finger sprite mapping
+void Game::updateHandSprites(const std::string& targetText, const std::string& userInput)
+{
+	if (userInput.size() >= targetText.size()) return;
+
+	// Only update textures if the next finger has changed
+	const FingerHint& hint = fingerHints.hintFor(targetText[userInput.size()]);
 
-	if (leftTex != currentLeftTex) {
-		leftHand->getComponent<SpriteComponent>().setTex(leftTex.c_str());
-		currentLeftTex = leftTex;
+	if (hint.left != currentLeftPose) {
+		leftHand->getComponent<SpriteComponent>().setTexture(fingerHints.leftTexture(hint.left));
+		currentLeftPose = hint.left;
 	}
 
-	if (rightTex != currentRightTex) {
-		rightHand->getComponent<SpriteComponent>().setTex(rightTex.c_str());
-		currentRightTex = rightTex;
+	if (hint.right != currentRightPose) {
+		rightHand->getComponent<SpriteComponent>().setTexture(fingerHints.rightTexture(hint.right));
+		currentRightPose = hint.right;
+	}
+}
+
+// Draws the active prompt centered over a zombie, each letter colored by what's been typed so far
+void Game::renderPrompt(int zombieCenterX, int textY)
+{
+	GlyphAtlas* atlas = uiManager ? uiManager->getAtlas(promptFont) : nullptr;
+	if (!atlas) {
+		return;
+	}
+
+	SDL_Color rectColor = { 255, 178, 102, 255 };
+
+	// Calculate total text width
+	int totalTextWidth = atlas->measureWidth(targetText.data(), targetText.size());
+
+	// Center textX based on zombie sprite's center and the text width
+	int textX = zombieCenterX - (totalTextWidth / 2);
+
+	// Center background rectangle
+	int rectWidth = totalTextWidth + 20; // With some padding
+	uiManager->drawRectangle(textX - 10, textY - 5, rectWidth, 25, rectColor);
+
+	// Queue letters with spacing, then draw them all at once
+	int letterX = textX;
+	int cursorX = textX;
+
+	for (size_t i = 0; i < targetText.size(); ++i) {
+		SDL_Color color = { 255, 255, 255, 255 }; // Default to white
+		if (i < userInput.size()) {
+			if (userInput[i] == targetText[i]) {
+				color = { 0, 255, 0, 255 }; // Green for correct input
+			}
+			else {
+				color = { 255, 0, 0, 255 }; // Red for incorrect input
+				processedInput[i] = true;
+			}
+		}
+
+		letterX = atlas->addText(&targetText[i], 1, letterX, textY, color) + 1;
+
+		// Update cursorX after the letter
+		if (i + 1 == userInput.size()) {
+			cursorX = letterX - 2;
+		}
+	}
+
+	atlas->flush();
+
+	// Handle fully typed case cursor at end
+	if (userInput.size() == targetText.size()) {
+		cursorX = letterX; // After last letter
+	}
+
+	// Draw cursor
+	if (showCursor && userInput.size() <= targetText.size()) {
+		// Change caret color if input is fully typed but incorrect
+		SDL_Color caretColor = { 255, 255, 255, 255 }; // Default to white
+
+		if (userInput.size() == targetText.size() && userInput != targetText) {
+			caretColor = { 255, 0, 0, 255 }; // Red for incorrect full word
+		}
+
+		int caretWidth = 2;
+		int caretHeight = 18;
+
+		SDL_Rect caretRect = {
+			cursorX,
+			textY,
+			caretWidth,
+			caretHeight
+		};
+
+		SDL_SetRenderDrawColor(renderer, caretColor.r, caretColor.g, caretColor.b, caretColor.a);
+		SDL_RenderFillRect(renderer, &caretRect);
 	}
 }
 
@@ -3998,8 +3991,13 @@ void Game::syncFromSaveData() {
 
 // Full autosave wrapper
 void Game::saveProgress() {
+	if (autosaveBlocked) {
+		std::cerr << "Autosave skipped, it would overwrite the unreadable autosave.sav\n";
+		return;
+	}
+
 	syncToSaveData();
-	if (SaveSystem::saveToFile("autosave.txt", saveData)) {
+	if (SaveSystem::saveToFile("autosave.sav", saveData)) {
 		std::cout << "Progress autosaved.\n";
 	}
 	else {
@@ -4009,11 +4007,38 @@ void Game::saveProgress() {
 
 // Full load wrapper
 void Game::loadProgress() {
-	if (SaveSystem::loadFromFile("autosave.txt", saveData)) {
+	if (SaveSystem::loadFromFile("autosave.sav", saveData)) {
 		syncFromSaveData();
 		std::cout << "Save file loaded.\n";
 	}
+	else if (SaveSystem::saveExists("autosave.sav")) {
+		// There is a binary save, it just can't be read. It's newer than autosave.txt, so don't migrate over it,
+		// and keep it for the player instead of letting the next autosave replace it
+		std::string aside = SaveSystem::moveAside("autosave.sav");
+		if (!aside.empty()) {
+			std::cerr << "autosave.sav could not be read, moved it to " << aside << ". Using defaults.\n";
+		}
+		else {
+			autosaveBlocked = true;
+			std::cerr << "autosave.sav could not be read or moved aside, autosave is off until it's fixed. Using defaults.\n";
+		}
+	}
 	else {
-		std::cerr << "No save file found. Using defaults.\n";
+		// No binary save yet. A lone autosave.sav.tmp that didn't load is the first save torn by a crash, nothing to keep
+		SaveSystem::discardTemp("autosave.sav");
+
+		if (SaveSystem::loadLegacyTextFile("autosave.txt", saveData)) {
+			// Older builds saved as text, carry that progress over (the text file is left as is)
+			syncFromSaveData();
+			if (SaveSystem::saveToFile("autosave.sav", saveData)) {
+				std::cout << "Save file migrated from autosave.txt.\n";
+			}
+			else {
+				std::cout << "Save file loaded from autosave.txt.\n";
+			}
+		}
+		else {
+			std::cerr << "No save file found. Using defaults.\n";
+		}
 	}
 }
\ No newline at end of file
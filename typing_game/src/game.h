@@ -5,9 +5,12 @@
 #include "WordListManager.h"
 #include "GameState.h"
 #include "SaveSystem.h"
+#include "KeystrokeBuffer.h"
+#include "FingerHints.h"
 #include <vector>
 #include <iostream>
 #include <sstream>
+#include <string_view>
 #include <unordered_map>
 
 class Game {
@@ -20,6 +23,10 @@ public:
 
 	// Game methods for main method
 	void handleEvents();
+	void handleEvent();
+	void handleKeystroke(const Keystroke& key);
+	void consumeKeystrokes();
+	bool typingNeedsUpdate() const;
 	void update();
 	void render();
 	void clean();
@@ -33,6 +40,13 @@ public:
 	//
 	//
 
+	// Benchmark hooks (bench/Benchmark.cpp jumps straight into a mode and types like a player)
+	void seedWords(uint32_t seed); // Same seed, same words and spawns every run
+	void ignoreWordWeakness(); // Draw words evenly, not leaning on the save's missed characters
+	void startMode(GameState mode, int arcadeLevel = 1);
+	GameState getState() const;
+	std::string_view getPendingInput() const; // What's left to type of the current prompt/line
+
 	// Lessons Mode methods
 	void resetLessonsMode(WordListManager::Difficulty lessonDifficulty);
 	void exitLessonsMode();
@@ -43,6 +57,9 @@ public:
 	void exitArcadeMode();
 	void nextLevel();
 	void bonusStage();
+	void buryTombstones();
+	void rankTargets();
+	void moveBonusRow(bool leftGroup);
 	void updateBarrierDamage(int barrierHP);
 	void checkCombo(const std::string& input, const std::string& target);
 	void fireLaser();
@@ -51,7 +68,8 @@ public:
 	void resetWPMTest();
 	void shiftWpmLines();
 	int countWords(const std::string& line);
-	std::string generateRandomLine();
+	void generateRandomLine(std::string& line);
+	void updateWordWeakness();
 	void calculateWPM();
 	std::string getTypingTitle(int highestWpm);
 
@@ -60,6 +78,7 @@ public:
 
 	// Shared method(s)
 	void updateHandSprites(const std::string& targetText, const std::string& userInput);
+	void renderPrompt(int zombieCenterX, int textY);
 	std::string formatPercentage(float value);
 
 	// Save/Load methods
@@ -79,11 +98,13 @@ public:
 
 	static SDL_Renderer* renderer;
 	static SDL_Event event;
+	static float renderAlpha; // Set by the main loop before render(), 1 draws the latest tick as is
 
 	SaveSystem::SaveData saveData;
 
 private:
 	bool isRunning = false;
+	bool autosaveBlocked = false; // autosave.sav couldn't be read or moved aside, so it's never written over
 	int cnt = 0;
 	bool showBlinkText = true;       // Controls whether the text is visible
 	Uint32 lastBlinkTime = 0;        // Tracks the last time the blink toggled
@@ -161,6 +182,7 @@ private:
 	int lessonTimeElapsed = 0;
 	int lessonStartTime = 0;
 	int lessonResultTime = 0;
+	Uint32 lessonFinishTime = 0; // Timestamp of the last keypress of the line
 
 	std::string lessonSummary;
 
@@ -326,13 +348,15 @@ private:
 	int y; 
 	int entryIndex;
 	std::unordered_map<char, int> lifetimeWrongCharacters; // Track how often each wrong letter is typed
+	bool wordWeaknessIgnored = false; // Set by the benchmark, so its words don't depend on whose save it runs with
 	std::vector<std::pair<char, int>> sortedWrongCharacters; // Sorts characters by most common to least common
 
 	// WPM Test variables:
 	//
 	//
 	//
-	Uint32 lastSecondTick = 0;
+	const Uint32 WPM_TEST_DURATION = 60000; // 1 minute, in ms
+	Uint32 wpmStartTime = 0; // Timestamp of the first keypress
 
 	std::string wpmTopLine;
 	std::string wpmCurrentLine;
@@ -373,6 +397,7 @@ private:
 	SDL_Color neutral;
 
 	std::unordered_map<char, int> typedWrong;
-	std::string currentLeftTex;
-	std::string currentRightTex;
+	FingerHints fingerHints;
+	HandPose currentLeftPose = HandPose::COUNT; // COUNT = not set yet, forces the next update
+	HandPose currentRightPose = HandPose::COUNT;
 };
\ No newline at end of file
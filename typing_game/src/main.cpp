@@ -1,38 +1,68 @@
 #include "Game.h"
+#include "GameClock.h"
+#include "FrameScheduler.h"
+#include <cstring>
+#include <cstdlib>
 
 Game* game = nullptr;
 
 int main(int argc, char* argv[])
 {
-	const int FPS = 60;
-	const int frameDelay = 1000 / FPS;
-
-	Uint32 frameStart;
-	int frameTime;
+	// --fps N caps drawing at N frames a second (0 for uncapped), --vsync lets the display pace it instead
+	int targetFPS = -1;
+	bool vsync = false;
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--vsync") == 0) {
+			vsync = true;
+		}
+		else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+			targetFPS = std::atoi(argv[++i]);
+		}
+	}
 
 	game = new Game();
 
 	game->init("Letter RIP", 1600, 900, false);
 
+	// By default draw as often as the display refreshes, the simulation itself always runs at GameClock::TICK_RATE
+	if (targetFPS < 0 && !vsync) {
+		targetFPS = GameClock::TICK_RATE;
+		SDL_DisplayMode displayMode;
+		if (SDL_GetCurrentDisplayMode(0, &displayMode) == 0 && displayMode.refresh_rate > targetFPS) {
+			targetFPS = displayMode.refresh_rate;
+		}
+	}
+
+	FrameScheduler scheduler(targetFPS);
+	if (vsync) {
+		scheduler.setVSync(Game::renderer, true);
+	}
+
+	GameClock clock;
+
 	while (game->running())
 	{
-		frameStart = SDL_GetTicks();
+		scheduler.beginFrame();
+		clock.beginFrame();
 
 		game->handleEvents();
-		game->update();
-		game->render();
-
-		frameTime = SDL_GetTicks() - frameStart;
 
-		// this is to smooth out the sprite's movement
-		if (frameDelay > frameTime)
-		{
-			SDL_Delay(frameDelay - frameTime);
+		// Catch the simulation up to real time, a slow frame runs extra ticks instead of slowing the game down
+		while (clock.step() && game->running()) {
+			game->update();
 		}
+
+		Game::renderAlpha = clock.getAlpha();
+		game->render();
+
+		// Pumping while we wait lets keystrokes get timestamped when they're pressed, not next frame
+		scheduler.waitForNextFrame();
 	}
 
+	scheduler.printStats(std::cout);
+
 	game->clean();
 
 	return 0;
 
-}
\ No newline at end of file
+}
@@ -50,11 +50,14 @@ Map::Map()
 
 Map::~Map()
 {
-	SDL_DestroyTexture(wall);
-	SDL_DestroyTexture(floorEasy);
-	SDL_DestroyTexture(floorMedium);
-	SDL_DestroyTexture(floorHard);
-	SDL_DestroyTexture(floorCaution);
+	clearDecals();
+	SDL_DestroyTexture(baked);
+	SDL_DestroyTexture(decalLayer);
+	TextureManager::Release(wall);
+	TextureManager::Release(floorEasy);
+	TextureManager::Release(floorMedium);
+	TextureManager::Release(floorHard);
+	TextureManager::Release(floorCaution);
 }
 
 void Map::loadMap(int arr[24][50])
@@ -66,9 +69,104 @@ void Map::loadMap(int arr[24][50])
 			map[row][column] = arr[row][column];
 		}
 	}
+
+	dirty = true;
 }
 
 void Map::drawMap(int offsetX, int offsetY)
+{
+	if (dirty) {
+		bake();
+	}
+
+	SDL_Rect mapRect = { offsetX, offsetY, 50 * 32, 24 * 32 };
+
+	if (baked) {
+		SDL_RenderCopy(Game::renderer, baked, nullptr, &mapRect);
+	}
+	else {
+		// Render targets not supported, draw tile by tile
+		drawTiles(offsetX, offsetY);
+	}
+
+	if (decalLayer) {
+		if (!decalLayerStale) {
+			SDL_RenderCopy(Game::renderer, decalLayer, nullptr, &mapRect);
+		}
+	}
+	else {
+		drawDecals(offsetX, offsetY);
+	}
+}
+
+// A transparent map-sized texture to render into, nullptr if render targets aren't supported
+SDL_Texture* Map::createLayer()
+{
+	if (!SDL_RenderTargetSupported(Game::renderer)) {
+		return nullptr;
+	}
+
+	SDL_Texture* layer = SDL_CreateTexture(Game::renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, 50 * 32, 24 * 32);
+	if (!layer) {
+		std::cout << "Failed to create map texture: " << SDL_GetError() << std::endl;
+		return nullptr;
+	}
+	SDL_SetTextureBlendMode(layer, SDL_BLENDMODE_BLEND);
+	return layer;
+}
+
+void Map::clearLayer(SDL_Texture* layer)
+{
+	SDL_Texture* previousTarget = SDL_GetRenderTarget(Game::renderer);
+	Uint8 r, g, b, a;
+	SDL_GetRenderDrawColor(Game::renderer, &r, &g, &b, &a);
+
+	SDL_SetRenderTarget(Game::renderer, layer);
+	SDL_SetRenderDrawColor(Game::renderer, 0, 0, 0, 0);
+	SDL_RenderClear(Game::renderer);
+
+	SDL_SetRenderTarget(Game::renderer, previousTarget);
+	SDL_SetRenderDrawColor(Game::renderer, r, g, b, a);
+}
+
+// Make sure the decal layer exists and is clean, false if there can't be one
+bool Map::prepareDecalLayer()
+{
+	if (!decalLayer) {
+		decalLayer = createLayer();
+		if (!decalLayer) {
+			return false;
+		}
+		decalLayerStale = true;
+	}
+
+	if (decalLayerStale) {
+		clearLayer(decalLayer);
+		decalLayerStale = false;
+	}
+	return true;
+}
+
+// Render every tile into the baked texture (only when the tiles or difficulty change)
+void Map::bake()
+{
+	dirty = false;
+
+	if (!baked) {
+		baked = createLayer();
+		if (!baked) {
+			return;
+		}
+	}
+
+	clearLayer(baked);
+
+	SDL_Texture* previousTarget = SDL_GetRenderTarget(Game::renderer);
+	SDL_SetRenderTarget(Game::renderer, baked);
+	drawTiles(0, 0);
+	SDL_SetRenderTarget(Game::renderer, previousTarget);
+}
+void Map::drawTiles(int offsetX, int offsetY)
 {
 	int type = 0;
 
@@ -114,8 +212,79 @@ void Map::drawMap(int offsetX, int offsetY)
 	}
 }
 
+// Oldest first, so newer corpses land on top like they do on the layer
+void Map::drawDecals(int offsetX, int offsetY)
+{
+	for (size_t i = 0; i < decals.size(); i++) {
+		const Decal& decal = decals[(oldestDecal + i) % decals.size()];
+		SDL_Rect dest = decal.dest;
+		dest.x += offsetX;
+		dest.y += offsetY;
+		TextureManager::Draw(decal.texture, decal.src, dest);
+	}
+}
+
+void Map::stampDecal(SDL_Texture* texture, const SDL_Rect& srcRect, const SDL_Rect& destRect)
+{
+	if (!texture) {
+		return;
+	}
+
+	if (prepareDecalLayer()) {
+		SDL_Texture* previousTarget = SDL_GetRenderTarget(Game::renderer);
+		SDL_SetRenderTarget(Game::renderer, decalLayer);
+		TextureManager::Draw(texture, srcRect, destRect);
+		SDL_SetRenderTarget(Game::renderer, previousTarget);
+		return;
+	}
+
+	// No render targets, keep it to draw every frame. Once the list is full the oldest one makes way
+	TextureManager::Retain(texture);
+	if (decals.size() < MAX_DECALS) {
+		decals.push_back({ texture, srcRect, destRect });
+	}
+	else {
+		TextureManager::Release(decals[oldestDecal].texture);
+		decals[oldestDecal] = { texture, srcRect, destRect };
+		oldestDecal = (oldestDecal + 1) % MAX_DECALS;
+	}
+}
+
+void Map::clearDecals()
+{
+	for (const Decal& decal : decals) {
+		TextureManager::Release(decal.texture);
+	}
+	decals.clear();
+	oldestDecal = 0;
+	decalLayerStale = true;
+}
+
+void Map::resetDevice()
+{
+	SDL_DestroyTexture(baked);
+	baked = nullptr;
+	dirty = true;
+
+	// Corpses painted on the layer go with it
+	SDL_DestroyTexture(decalLayer);
+	decalLayer = nullptr;
+	decalLayerStale = true;
+
+	wall = TextureManager::Reloaded(wall);
+	floorEasy = TextureManager::Reloaded(floorEasy);
+	floorMedium = TextureManager::Reloaded(floorMedium);
+	floorHard = TextureManager::Reloaded(floorHard);
+	floorCaution = TextureManager::Reloaded(floorCaution);
+
+	for (Decal& decal : decals) {
+		decal.texture = TextureManager::Reloaded(decal.texture);
+	}
+}
+
 void Map::setDifficulty(MapLevel difficulty) {
 	currentDifficulty = difficulty;
+	dirty = true;
 
 	std::cout << "Map difficulty set to: " << static_cast<int>(difficulty) << std::endl;
 
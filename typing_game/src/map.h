@@ -1,5 +1,6 @@
 #pragma once
 #include "Game.h"
+#include <vector>
 
 enum class MapLevel {
 	EASY,
@@ -18,6 +19,18 @@ public:
 
 	void setDifficulty(MapLevel currentDifficulty);
 
+	// Call when the renderer loses target texture contents (SDL_RENDER_TARGETS_RESET).
+	// Tiles are baked again, decals painted so far are gone with the layer's contents.
+	void invalidate() { dirty = true; decalLayerStale = true; }
+
+	// Call when the renderer device is lost (SDL_RENDER_DEVICE_RESET), after TextureManager::ReloadAll.
+	// The baked texture is gone, not just its contents, so it's recreated, and tiles/decals switch to the reloaded textures.
+	void resetDevice();
+
+	// Paint a sprite frame onto the floor (defeated zombies) until clearDecals. Nothing is kept per decal,
+	// so drawing them costs the same however many there are
+	void stampDecal(SDL_Texture* texture, const SDL_Rect& srcRect, const SDL_Rect& destRect);
+	void clearDecals();
 
 private:
 	MapLevel currentDifficulty = MapLevel::EASY;
@@ -31,4 +44,28 @@ private:
 
 	int map[24][50];
 
+	// Whole map pre-rendered once, so drawing it is a single copy
+	SDL_Texture* baked = nullptr;
+	bool dirty = true;
+
+	// Decals are painted onto their own layer as they come in, so re-baking the tiles never repaints them
+	SDL_Texture* decalLayer = nullptr;
+	bool decalLayerStale = true; // Contents lost or cleared, wiped before the next decal goes on
+
+	// Only without render targets: drawn one by one every frame, so only the newest MAX_DECALS are kept
+	static constexpr size_t MAX_DECALS = 64;
+	struct Decal {
+		SDL_Texture* texture;
+		SDL_Rect src, dest;
+	};
+	std::vector<Decal> decals;
+	size_t oldestDecal = 0;
+
+	SDL_Texture* createLayer();
+	void clearLayer(SDL_Texture* layer);
+	bool prepareDecalLayer();
+	void bake();
+	void drawTiles(int offsetX, int offsetY);
+	void drawDecals(int offsetX, int offsetY);
+
 };
\ No newline at end of file